@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    mpe-zones.c
+    Checks that tMPEPoly_setZones gives each channel the right master bend.
+
+  ==============================================================================
+*/
+
+#include <stdio.h>
+
+#include "mpe-zones.h"
+
+LEAF leaf;
+
+void exampleInit()
+{
+    LEAF_init(&leaf, 48000, mempool, 100000, &exampleRandom);
+    
+    tMPEPoly_init(&mpe, 4, &leaf);
+    tMPEPoly_setSmoothTime(&mpe, 0.0f);
+}
+
+void exampleFrame()
+{
+    
+}
+
+float exampleTick(float sampleIn)
+{
+    return sampleIn;
+}
+
+float exampleRandom()
+{
+    return ((float)rand()/(float)(RAND_MAX));
+}
+
+typedef struct
+{
+    int lower, upper; // requested member counts
+    int expectLower, expectUpper; // layout after the lower zone gives way
+} ZoneCase;
+
+static const ZoneCase cases[] =
+{
+    { 15, 0, 15, 0 },
+    { 0, 15, 0, 15 },
+    { 7, 7, 7, 7 },
+    { 10, 10, 4, 10 },
+    { 14, 1, 13, 1 },
+    { 15, 15, 0, 15 },
+    { 0, 0, 0, 0 },
+};
+
+// Plays a note on every member channel with the lower master bent up and the
+// upper master bent down, and checks that each note follows its own master.
+// Returns 1 on a mismatch.
+static int runCase(const ZoneCase* c)
+{
+    int failed = 0;
+    
+    for (int channel = 0; channel < 16; channel++)
+    {
+        float expected = 0.0f;
+        if (channel >= 1 && channel <= c->expectLower) expected = 2.0f;
+        else if (channel <= 14 && channel >= 15 - c->expectUpper) expected = -2.0f;
+        else continue;
+        
+        exampleInit();
+        tMPEPoly_setZones(&mpe, c->lower, c->upper);
+        int voice = tMPEPoly_noteOn(&mpe, channel, 60, 100);
+        if (c->expectLower > 0) tMPEPoly_pitchBend(&mpe, 0, 16384 - 1);
+        if (c->expectUpper > 0) tMPEPoly_pitchBend(&mpe, 15, 0);
+        tMPEPoly_tickBlock(&mpe, 64);
+        
+        // full up is one step short of the range
+        float bend = tMPEPoly_getPitch(&mpe, voice) - 60.0f;
+        if (expected > 0.0f) expected *= 8191.0f / 8192.0f;
+        if (fabsf(bend - expected) > 0.0001f)
+        {
+            printf("    zones %d/%d channel %d: bend %f, expected %f\n", c->lower, c->upper, channel, bend, expected);
+            failed = 1;
+        }
+    }
+    
+    printf("zones %2d/%-2d  %s\n", c->lower, c->upper, failed ? "FAIL" : "pass");
+    return failed;
+}
+
+// Returns the number of failed layouts, so 0 means success.
+int exampleZonesTest()
+{
+    int failures = 0;
+    
+    for (int i = 0; i < (int)(sizeof(cases) / sizeof(cases[0])); i++)
+        failures += runCase(&cases[i]);
+    
+    return failures;
+}
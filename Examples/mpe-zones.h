@@ -0,0 +1,23 @@
+/*
+  ==============================================================================
+
+    mpe-zones.h
+    Checks that tMPEPoly_setZones gives each channel the right master bend.
+
+  ==============================================================================
+*/
+
+#include "../leaf/leaf.h"
+
+char mempool[100000];
+tMPEPoly mpe;
+
+void    exampleInit(void);
+
+void    exampleFrame(void);
+
+float   exampleTick(float sampleIn);
+
+float   exampleRandom(void);
+
+int     exampleZonesTest(void);
@@ -0,0 +1,143 @@
+/*
+  ==============================================================================
+
+    quality-tiers.c
+    Error-versus-speed table of the LEAFQuality tiers.
+
+  ==============================================================================
+*/
+
+#include <stdio.h>
+#include <time.h>
+
+#include "quality-tiers.h"
+
+#define BENCH_SAMPLES 480000
+
+LEAF leaf;
+
+static const char* tierNames[3] = { "high", "balanced", "fast" };
+
+void exampleInit()
+{
+    LEAF_init(&leaf, 48000, mempool, 100000, &exampleRandom);
+    
+    tSVF_init(&svf, SVFTypeLowpass, 1000.0f, 0.7f, &leaf);
+    tVZFilter_init(&vzf, Bell, 1000.0f, 1.0f, &leaf);
+    tDiodeFilter_init(&diode, 1000.0f, 0.5f, &leaf);
+}
+
+void exampleFrame()
+{
+    
+}
+
+float exampleTick(float sampleIn)
+{
+    return tDiodeFilter_tick(&diode, sampleIn);
+}
+
+float exampleRandom()
+{
+    return ((float)rand()/(float)(RAND_MAX));
+}
+
+static float input[BENCH_SAMPLES];
+static float output[3][BENCH_SAMPLES];
+
+static float maxError(const float* a, const float* b, int n, int relative)
+{
+    float error = 0.0f;
+    for (int i = 0; i < n; i++)
+    {
+        float e = fabsf(a[i] - b[i]);
+        if (relative) e /= fabsf(b[i]);
+        if (e > error) error = e;
+    }
+    return error;
+}
+
+static double nsPerCall(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC * 1e9 / BENCH_SAMPLES;
+}
+
+// run one of the approximations over the input, returning ns per call
+static double runFunction(int which, LEAFQuality q, float* out)
+{
+    clock_t start = clock();
+    for (int i = 0; i < BENCH_SAMPLES; i++)
+    {
+        float x = input[i];
+        if (which == 0)         out[i] = LEAF_tanQuality(x * 1.5f, q);
+        else if (which == 1)    out[i] = LEAF_tanhQuality(x * 6.0f, q);
+        else                    out[i] = LEAF_exp2Quality(x * 16.0f - 8.0f, q);
+    }
+    return nsPerCall(start);
+}
+
+void exampleQualityBenchmark()
+{
+    const char* functionNames[3] = { "tan [0, 1.5]", "tanh [-6, 6]", "exp2 [-8, 8]" };
+    
+    exampleInit();
+    for (int i = 0; i < BENCH_SAMPLES; i++) input[i] = exampleRandom();
+    
+    printf("function       tier      max error  ns/call\n");
+    for (int f = 0; f < 3; f++)
+    {
+        double time[3];
+        for (int q = 0; q < 3; q++) time[q] = runFunction(f, (LEAFQuality) q, output[q]);
+        
+        // relative error for tan and exp2, absolute for tanh
+        for (int q = 0; q < 3; q++)
+            printf("%-14s %-8s  %9.2e  %7.2f\n", functionNames[f], tierNames[q],
+                   maxError(output[q], output[0], BENCH_SAMPLES, f != 1), time[q]);
+    }
+    
+    // random cutoffs from 20 Hz to 20 kHz
+    for (int i = 0; i < BENCH_SAMPLES; i++) input[i] = 20.0f + 19980.0f * exampleRandom();
+    
+    printf("\nobject                       tier      max error  ns/call\n");
+    for (int q = 0; q < 3; q++)
+    {
+        LEAF_setQuality(&leaf, (LEAFQuality) q);
+        _tSVF* s = svf;
+        clock_t start = clock();
+        for (int i = 0; i < BENCH_SAMPLES; i++)
+        {
+            tSVF_setFreq(&svf, input[i]);
+            output[q][i] = s->g;
+        }
+        double time = nsPerCall(start);
+        printf("%-28s %-8s  %9.2e  %7.2f\n", "tSVF_setFreq (g, rel.)", tierNames[q],
+               maxError(output[q], output[0], BENCH_SAMPLES, 1), time);
+    }
+    for (int q = 0; q < 3; q++)
+    {
+        LEAF_setQuality(&leaf, (LEAFQuality) q);
+        _tVZFilter* v = vzf;
+        clock_t start = clock();
+        for (int i = 0; i < BENCH_SAMPLES; i++)
+        {
+            tVZFilter_setFreq(&vzf, input[i]);
+            output[q][i] = v->R2;
+        }
+        double time = nsPerCall(start);
+        printf("%-28s %-8s  %9.2e  %7.2f\n", "tVZFilter_setFreq (R2, rel.)", tierNames[q],
+               maxError(output[q], output[0], BENCH_SAMPLES, 1), time);
+    }
+    for (int i = 0; i < BENCH_SAMPLES; i++) input[i] = 2.0f * sinf(i * TWO_PI * 110.0f / 48000.0f);
+    for (int q = 0; q < 3; q++)
+    {
+        tDiodeFilter_free(&diode);
+        LEAF_setQuality(&leaf, (LEAFQuality) q);
+        tDiodeFilter_init(&diode, 2000.0f, 0.5f, &leaf);
+        clock_t start = clock();
+        for (int i = 0; i < BENCH_SAMPLES; i++)
+            output[q][i] = tDiodeFilter_tick(&diode, input[i]);
+        double time = nsPerCall(start);
+        printf("%-28s %-8s  %9.2e  %7.2f\n", "tDiodeFilter_tick", tierNames[q],
+               maxError(output[q], output[0], BENCH_SAMPLES, 0), time);
+    }
+}
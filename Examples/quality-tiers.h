@@ -0,0 +1,25 @@
+/*
+  ==============================================================================
+
+    quality-tiers.h
+    Error-versus-speed table of the LEAFQuality tiers.
+
+  ==============================================================================
+*/
+
+#include "../leaf/leaf.h"
+
+char mempool[100000];
+tSVF svf;
+tVZFilter vzf;
+tDiodeFilter diode;
+
+void    exampleInit(void);
+
+void    exampleFrame(void);
+
+float   exampleTick(float sampleIn);
+
+float   exampleRandom(void);
+
+void    exampleQualityBenchmark(void);
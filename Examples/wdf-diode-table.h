@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    wdf-diode-table.h
+    Error-versus-speed comparison of the tabulated and exact WDF diode solves.
+
+  ==============================================================================
+*/
+
+#include "../leaf/leaf.h"
+
+char mempool[100000];
+tWDF source, capacitor, parallel, diodes;
+tWDFProgram program;
+
+void    exampleInit(void);
+
+void    exampleFrame(void);
+
+float   exampleTick(float sampleIn);
+
+float   exampleRandom(void);
+
+void    exampleDiodeTableBenchmark(void);
@@ -0,0 +1,105 @@
+/*
+  ==============================================================================
+
+    wdf-program-recompile.c
+    Checks that recompiling a running tWDFProgram keeps its output continuous.
+
+  ==============================================================================
+*/
+
+#include <stdio.h>
+
+#include "wdf-program-recompile.h"
+
+#define TEST_SAMPLES 48000
+
+LEAF leaf;
+
+void exampleInit()
+{
+    LEAF_init(&leaf, 48000, mempool, 100000, &exampleRandom);
+    
+    // two identical diode clippers, one to recompile and one to compare against
+    for (int i = 0; i < 2; i++)
+    {
+        tWDF_init(&source[i], ResistiveSource, 2200.0f, NULL, NULL, &leaf);
+        tWDF_init(&capacitor[i], Capacitor, 0.0000001f, NULL, NULL, &leaf);
+        tWDF_init(&parallel[i], ParallelAdaptor, 0.0f, &source[i], &capacitor[i], &leaf);
+        tWDF_init(&diodes[i], DiodePair, 0.0f, &parallel[i], NULL, &leaf);
+        tWDFProgram_init(&program[i], &diodes[i], &capacitor[i], &leaf);
+    }
+}
+
+void exampleFrame()
+{
+    
+}
+
+float exampleTick(float sampleIn)
+{
+    return tWDFProgram_tick(&program[0], sampleIn);
+}
+
+float exampleRandom()
+{
+    return ((float)rand()/(float)(RAND_MAX));
+}
+
+// Runs both programs on a hot 220 Hz tone. Halfway through, recompile is
+// applied to program 1 and reference to program 0. The outputs must match
+// sample for sample. Returns 1 on a mismatch.
+static int runCheck(const char* name, void (*recompile)(void), void (*reference)(void))
+{
+    float error = 0.0f;
+    int first = -1;
+    
+    for (int i = 0; i < TEST_SAMPLES; i++)
+    {
+        if (i == TEST_SAMPLES / 2)
+        {
+            reference();
+            recompile();
+        }
+        float x = 4.0f * sinf(i * TWO_PI * 220.0f / 48000.0f);
+        float e = fabsf(tWDFProgram_tick(&program[1], x) - tWDFProgram_tick(&program[0], x));
+        if (e > error) error = e;
+        if (e > 0.0f && first < 0) first = i;
+    }
+    
+    printf("%-36s max difference %9.2e  %s\n", name, error, (first < 0) ? "pass" : "FAIL");
+    if (first >= 0) printf("    first mismatch at sample %d, recompiled at %d\n", first, TEST_SAMPLES / 2);
+    return first >= 0;
+}
+
+static void nothing(void) { }
+
+static void recompile(void)
+{
+    tWDFProgram_compile(&program[1]);
+}
+
+static void setValueCompiled(void)
+{
+    tWDFProgram_setValue(&program[0], &capacitor[0], 0.00000022f);
+}
+
+static void setValueThenRecompile(void)
+{
+    tWDF_setValue(&capacitor[1], 0.00000022f);
+    tWDFProgram_compile(&program[1]);
+}
+
+// Returns the number of failed checks, so 0 means success and it can be used
+// as a process exit status.
+int exampleRecompileTest()
+{
+    int failures = 0;
+    
+    exampleInit();
+    failures += runCheck("recompile mid-stream", &recompile, &nothing);
+    
+    exampleInit();
+    failures += runCheck("tWDF_setValue and recompile", &setValueThenRecompile, &setValueCompiled);
+    
+    return failures;
+}
@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+
+    wdf-program-recompile.h
+    Checks that recompiling a running tWDFProgram keeps its output continuous.
+
+  ==============================================================================
+*/
+
+#include "../leaf/leaf.h"
+
+char mempool[100000];
+tWDF source[2], capacitor[2], parallel[2], diodes[2];
+tWDFProgram program[2];
+
+void    exampleInit(void);
+
+void    exampleFrame(void);
+
+float   exampleTick(float sampleIn);
+
+float   exampleRandom(void);
+
+int     exampleRecompileTest(void);
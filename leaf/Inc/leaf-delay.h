@@ -32,6 +32,7 @@ extern "C" {
      @defgroup tdelay tDelay
      @ingroup delay
      @brief Non-interpolating delay, reimplemented from STK (Cook and Scavone).
+     If maxDelay is a power of two (see LEAF_nextPowerOfTwo()), buffer indices are wrapped with a bit mask instead of compares and modulos.
      @{
      
      @fn void        tDelay_init         (tDelay* const, uint32_t delay, uint32_t maxDelay, LEAF* const leaf)
@@ -91,6 +92,13 @@ extern "C" {
      @param input
      @return
      
+     @fn void    tDelay_tickBlock (tDelay* const, float* input, float* output, int numSamples)
+     @brief Process a block of samples. Writes and reads are done as contiguous spans of the buffer, in chunks short enough that the result matches calling tDelay_tick() on each sample.
+     @param delay A pointer to the relevant tDelay.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
      @fn float       tDelay_getLastOut   (tDelay* const)
      @brief
      @param delay A pointer to the relevant tDelay.
@@ -115,6 +123,7 @@ extern "C" {
         uint32_t inPoint, outPoint;
         
         uint32_t delay, maxDelay;
+        uint32_t bufferMask;
         
     } _tDelay;
     
@@ -131,6 +140,7 @@ extern "C" {
     float       tDelay_tapOut       (tDelay* const, uint32_t tapDelay);
     float       tDelay_addTo        (tDelay* const, float value, uint32_t tapDelay);
     float       tDelay_tick         (tDelay* const, float sample);
+    void        tDelay_tickBlock    (tDelay* const, float* input, float* output, int numSamples);
     float       tDelay_getLastOut   (tDelay* const);
     float       tDelay_getLastIn    (tDelay* const);
     
@@ -140,6 +150,7 @@ extern "C" {
      @defgroup tlineardelay tLinearDelay
      @ingroup delay
      @brief Linearly-interpolating delay, reimplemented from STK (Cook and Scavone).
+     If maxDelay is a power of two (see LEAF_nextPowerOfTwo()), buffer indices are wrapped with a bit mask instead of compares and modulos.
      @{
      
      @fn void    tLinearDelay_init        (tLinearDelay* const, float delay, uint32_t maxDelay, LEAF* const leaf)
@@ -199,6 +210,13 @@ extern "C" {
      @param input
      @return
      
+     @fn void    tLinearDelay_tickBlock (tLinearDelay* const, float* input, float* output, int numSamples)
+     @brief Process a block of samples. Writes and interpolated reads are done as contiguous spans of the buffer. Matches calling tLinearDelay_tick() on each sample.
+     @param delay A pointer to the relevant tLinearDelay.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
      @fn void    tLinearDelay_tickIn      (tLinearDelay* const, float input)
      @brief
      @param delay A pointer to the relevant tLinearDelay.
@@ -233,6 +251,7 @@ extern "C" {
         uint32_t inPoint, outPoint;
         
         uint32_t maxDelay;
+        uint32_t bufferMask;
         
         float delay;
         
@@ -253,6 +272,7 @@ extern "C" {
     float   tLinearDelay_tapOut      (tLinearDelay* const, uint32_t tapDelay);
     float   tLinearDelay_addTo       (tLinearDelay* const, float value, uint32_t tapDelay);
     float   tLinearDelay_tick        (tLinearDelay* const, float sample);
+    void    tLinearDelay_tickBlock   (tLinearDelay* const, float* input, float* output, int numSamples);
     void    tLinearDelay_tickIn      (tLinearDelay* const, float input);
     float   tLinearDelay_tickOut     (tLinearDelay* const);
     float   tLinearDelay_getLastOut  (tLinearDelay* const);
@@ -296,6 +316,13 @@ extern "C" {
      @param input
      @return
      
+     @fn void    tHermiteDelay_tickBlock (tHermiteDelay* const, float* input, float* output, int numSamples)
+     @brief Process a block of samples. Writes and interpolated reads are done as contiguous spans of the buffer. Matches calling tHermiteDelay_tick() on each sample.
+     @param delay A pointer to the relevant tHermiteDelay.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
      @fn void       tHermiteDelay_tickIn         (tHermiteDelay* const dl, float input)
      @brief
      @param delay A pointer to the relevant tHermiteDelay.
@@ -389,6 +416,7 @@ extern "C" {
     
     void    tHermiteDelay_clear         (tHermiteDelay* const dl);
     float   tHermiteDelay_tick          (tHermiteDelay* const dl, float input);
+    void    tHermiteDelay_tickBlock     (tHermiteDelay* const dl, float* input, float* output, int numSamples);
     void    tHermiteDelay_tickIn        (tHermiteDelay* const dl, float input);
     float   tHermiteDelay_tickOut       (tHermiteDelay* const dl);
     void    tHermiteDelay_setDelay      (tHermiteDelay* const dl, float delay);
@@ -409,6 +437,7 @@ extern "C" {
      @defgroup tallpassdelay tAllpassDelay
      @ingroup delay
      @brief Allpass-interpolating delay, reimplemented from STK (Cook and Scavone).
+     If maxDelay is a power of two (see LEAF_nextPowerOfTwo()), buffer indices are wrapped with a bit mask instead of compares and modulos.
      @{
      
      @fn void    tAllpassDelay_init        (tAllpassDelay* const, float delay, uint32_t maxDelay, LEAF* const leaf)
@@ -468,6 +497,13 @@ extern "C" {
      @param input
      @return
      
+     @fn void    tAllpassDelay_tickBlock (tAllpassDelay* const, float* input, float* output, int numSamples)
+     @brief Process a block of samples. Writes are done as contiguous spans of the buffer; the allpass interpolation itself is recursive and runs per sample. Matches calling tAllpassDelay_tick() on each sample.
+     @param delay A pointer to the relevant tAllpassDelay.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
      @fn float   tAllpassDelay_getLastOut  (tAllpassDelay* const)
      @brief
      @param delay A pointer to the relevant tAllpassDelay.
@@ -492,6 +528,7 @@ extern "C" {
         uint32_t inPoint, outPoint;
         
         uint32_t maxDelay;
+        uint32_t bufferMask;
         
         float delay;
         
@@ -514,6 +551,7 @@ extern "C" {
     float   tAllpassDelay_tapOut      (tAllpassDelay* const, uint32_t tapDelay);
     float   tAllpassDelay_addTo       (tAllpassDelay* const, float value, uint32_t tapDelay);
     float   tAllpassDelay_tick        (tAllpassDelay* const, float sample);
+    void    tAllpassDelay_tickBlock   (tAllpassDelay* const, float* input, float* output, int numSamples);
     float   tAllpassDelay_getLastOut  (tAllpassDelay* const);
     float   tAllpassDelay_getLastIn   (tAllpassDelay* const);
     
@@ -523,6 +561,7 @@ extern "C" {
      @defgroup ttapedelay tTapeDelay
      @ingroup delay
      @brief Linear interpolating delay with fixed read and write pointers, variable rate.
+     If maxDelay is a power of two (see LEAF_nextPowerOfTwo()), buffer indices are wrapped with a bit mask instead of compares and modulos.
      @{
      
      @fn void    tTapeDelay_init        (tTapeDelay* const, float delay, uint32_t maxDelay, LEAF* const leaf)
@@ -582,6 +621,13 @@ extern "C" {
      @param input
      @return
      
+     @fn void    tTapeDelay_tickBlock (tTapeDelay* const, float* input, float* output, int numSamples)
+     @brief Process a block of samples. Runs the variable-rate read head per sample with the object state held in locals. Matches calling tTapeDelay_tick() on each sample.
+     @param delay A pointer to the relevant tTapeDelay.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
      @fn void    tTapeDelay_incrementInPoint(tTapeDelay* const dl)
      @brief
      @param delay A pointer to the relevant tTapeDelay.
@@ -610,6 +656,7 @@ extern "C" {
         uint32_t inPoint;
         
         uint32_t maxDelay;
+        uint32_t bufferMask;
         
         float delay, inc, idx;
         
@@ -630,6 +677,7 @@ extern "C" {
     float   tTapeDelay_tapOut      (tTapeDelay* const d, float tapDelay);
     float   tTapeDelay_addTo       (tTapeDelay* const, float value, uint32_t tapDelay);
     float   tTapeDelay_tick        (tTapeDelay* const, float sample);
+    void    tTapeDelay_tickBlock   (tTapeDelay* const, float* input, float* output, int numSamples);
     void    tTapeDelay_incrementInPoint(tTapeDelay* const dl);
     float   tTapeDelay_getLastOut  (tTapeDelay* const);
     float   tTapeDelay_getLastIn   (tTapeDelay* const);
@@ -708,6 +756,156 @@ extern "C" {
     float   tRingBuffer_get      (tRingBuffer* const ring, int index);
     int     tRingBuffer_getSize  (tRingBuffer* const ring);
     
+    //==============================================================================
+    
+    /*!
+     @defgroup tmultitapdelay tMultiTapDelay
+     @ingroup delay
+     @brief Multi-tap delay with per-tap gain, pan and LFO modulation, reading every tap from one shared buffer. For chorus, ensemble and early reflections.
+     @{
+     
+     @fn void    tMultiTapDelay_init        (tMultiTapDelay* const, uint32_t maxDelay, int numTaps, LEAF* const leaf)
+     @brief Initialize a tMultiTapDelay to the default mempool of a LEAF instance.
+     @param delay A pointer to the tMultiTapDelay to initialize.
+     @param maxDelay The maximum delay of any tap in samples, including LFO depth.
+     @param numTaps The number of taps.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tMultiTapDelay_initToPool  (tMultiTapDelay* const, uint32_t maxDelay, int numTaps, tMempool* const)
+     @brief Initialize a tMultiTapDelay to a specified mempool.
+     @param delay A pointer to the tMultiTapDelay to initialize.
+     @param maxDelay The maximum delay of any tap in samples, including LFO depth.
+     @param numTaps The number of taps.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tMultiTapDelay_free        (tMultiTapDelay* const)
+     @brief Free a tMultiTapDelay from its mempool.
+     @param delay A pointer to the tMultiTapDelay to free.
+     
+     @fn void    tMultiTapDelay_clear       (tMultiTapDelay* const)
+     @brief Clear the delay buffer.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     
+     @fn float   tMultiTapDelay_tick        (tMultiTapDelay* const, float input)
+     @brief Tick the delay and return the sum of all taps. Block processing is much cheaper.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param input The input sample.
+     @return The summed output of the taps.
+     
+     @fn void    tMultiTapDelay_tickBlock   (tMultiTapDelay* const, float* input, float* output, int numSamples)
+     @brief Process a block, summing all taps into a mono output. Tap delays move linearly across each chunk of MULTITAP_CHUNK samples toward their modulated targets, so delay changes are glide-free without per-sample LFO evaluation.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tMultiTapDelay_tickStereoBlock (tMultiTapDelay* const, float* input, float* outputL, float* outputR, int numSamples)
+     @brief Process a block, panning each tap into a stereo output.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param input The input block.
+     @param outputL The left output block. May be the same as the input block.
+     @param outputR The right output block.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tMultiTapDelay_setTapDelay (tMultiTapDelay* const, int tap, float delay)
+     @brief Set the center delay of a tap.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param tap The tap index.
+     @param delay The delay in samples.
+     
+     @fn float   tMultiTapDelay_getTapDelay (tMultiTapDelay* const, int tap)
+     @brief Get the center delay of a tap.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param tap The tap index.
+     @return The delay in samples.
+     
+     @fn void    tMultiTapDelay_setTapGain  (tMultiTapDelay* const, int tap, float gain)
+     @brief Set the gain of a tap.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param tap The tap index.
+     @param gain The gain. A gain of 0 skips the tap.
+     
+     @fn void    tMultiTapDelay_setTapPan   (tMultiTapDelay* const, int tap, float pan)
+     @brief Set the constant-power stereo position of a tap, used by tMultiTapDelay_tickStereoBlock().
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param tap The tap index.
+     @param pan The position from 0.0 (left) to 1.0 (right).
+     
+     @fn void    tMultiTapDelay_setTapLFO   (tMultiTapDelay* const, int tap, float rate, float depth)
+     @brief Set the sine LFO that modulates a tap's delay.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param tap The tap index.
+     @param rate The LFO rate in Hz.
+     @param depth The LFO depth in samples. A depth of 0 turns the LFO off.
+     
+     @fn void    tMultiTapDelay_setTapLFOPhase (tMultiTapDelay* const, int tap, float phase)
+     @brief Set the phase of a tap's LFO, for spreading ensemble voices.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param tap The tap index.
+     @param phase The phase from 0.0 to 1.0.
+     
+     @fn int     tMultiTapDelay_getNumTaps  (tMultiTapDelay* const)
+     @brief Get the number of taps.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @return The number of taps.
+     
+     @fn void    tMultiTapDelay_setSampleRate (tMultiTapDelay* const, float sr)
+     @brief Set the sample rate used for LFO rates.
+     @param delay A pointer to the relevant tMultiTapDelay.
+     @param sr The new sample rate.
+     ￼￼￼
+     @} */
+    
+#define MULTITAP_CHUNK 64
+    
+    typedef struct _tMultiTapDelay
+    {
+        tMempool mempool;
+        
+        float* buff;
+        uint32_t bufferMask;
+        uint32_t maxDelay;
+        uint32_t inPoint;
+        
+        int numTaps;
+        
+        // per-tap parameters, carved from one allocation
+        float* taps;
+        float* delay;
+        float* current;
+        float* gain;
+        float* gainL;
+        float* gainR;
+        float* pan;
+        float* lfoPhase;
+        float* lfoInc;
+        float* lfoRate;
+        float* lfoDepth;
+        
+        float sampleRate;
+        float invSampleRate;
+        
+    } _tMultiTapDelay;
+    
+    typedef _tMultiTapDelay* tMultiTapDelay;
+    
+    void    tMultiTapDelay_init        (tMultiTapDelay* const, uint32_t maxDelay, int numTaps, LEAF* const leaf);
+    void    tMultiTapDelay_initToPool  (tMultiTapDelay* const, uint32_t maxDelay, int numTaps, tMempool* const);
+    void    tMultiTapDelay_free        (tMultiTapDelay* const);
+    
+    void    tMultiTapDelay_clear       (tMultiTapDelay* const);
+    float   tMultiTapDelay_tick        (tMultiTapDelay* const, float input);
+    void    tMultiTapDelay_tickBlock   (tMultiTapDelay* const, float* input, float* output, int numSamples);
+    void    tMultiTapDelay_tickStereoBlock (tMultiTapDelay* const, float* input, float* outputL, float* outputR, int numSamples);
+    void    tMultiTapDelay_setTapDelay (tMultiTapDelay* const, int tap, float delay);
+    float   tMultiTapDelay_getTapDelay (tMultiTapDelay* const, int tap);
+    void    tMultiTapDelay_setTapGain  (tMultiTapDelay* const, int tap, float gain);
+    void    tMultiTapDelay_setTapPan   (tMultiTapDelay* const, int tap, float pan);
+    void    tMultiTapDelay_setTapLFO   (tMultiTapDelay* const, int tap, float rate, float depth);
+    void    tMultiTapDelay_setTapLFOPhase (tMultiTapDelay* const, int tap, float phase);
+    int     tMultiTapDelay_getNumTaps  (tMultiTapDelay* const);
+    void    tMultiTapDelay_setSampleRate (tMultiTapDelay* const, float sr);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -110,17 +110,45 @@ extern "C" {
      @brief
      @param oversampler A pointer to the relevant tOversampler.
      
+     @fn void    tOversampler_processBlock   (tOversampler* const, float* input, float* output, int numSamples, void (*effect)(void* ctx, float* buffer, int numSamples), void* ctx)
+     @brief Upsample a block, run an effect on the oversampled signal, and downsample it back. The filters run across the whole block rather than one input sample at a time, and the effect gets each oversampled chunk of up to OVERSAMPLER_BLOCK_SIZE input samples as one buffer to process in place, together with the context pointer. Shares its filter state with tOversampler_tick.
+     @param oversampler A pointer to the relevant tOversampler.
+     @param input The input block.
+     @param output The output block. May be the same as the input.
+     @param numSamples The number of samples in the block.
+     @param effect The effect to run on the oversampled buffer, or NULL.
+     @param ctx A pointer passed on to the effect.
+     
      @fn void    tOversampler_setRatio       (tOversampler* const, int ratio)
      @brief
      @param oversampler A pointer to the relevant tOversampler.
      @param ratio
      
+     @fn void    tOversampler_setType        (tOversampler* const, OversamplerType type)
+     @brief Choose between the linear phase FIR filters and cascaded 2x polyphase allpass half-band IIR filters. The IIR filters have much lower latency and take roughly a tenth of the multiplies, at the cost of a phase response that isn't linear. Ratio and quality work the same for both.
+     @param oversampler A pointer to the relevant tOversampler.
+     @param type The filter type, OversamplerFIR or OversamplerIIR.
+     
      @fn int     tOversampler_getLatency     (tOversampler* const os)
-     @brief
+     @brief Get the latency in samples. For the IIR filters this is the group delay at low frequencies, rounded.
      @param oversampler A pointer to the relevant tOversampler.
      ￼￼￼
      @} */
     
+    // number of input samples the block processing works on at once
+#ifndef OVERSAMPLER_BLOCK_SIZE
+#define OVERSAMPLER_BLOCK_SIZE 32
+#endif
+#define OVERSAMPLER_LANES 8
+#define OVERSAMPLER_IIR_MAX_COEFFS 8
+    
+    typedef enum OversamplerType
+    {
+        OversamplerFIR = 0,
+        OversamplerIIR,
+        OversamplerTypeNil
+    } OversamplerType;
+    
     typedef struct _tOversampler
     {
         tMempool mempool;
@@ -131,8 +159,13 @@ extern "C" {
         float* pCoeffs;
         float* upState;
         float* downState;
+        float* phaseState;
         int numTaps;
         int phaseLength;
+        OversamplerType type;
+        float* iirState;
+        int numStages;
+        int latency;
     } _tOversampler;
     
     typedef _tOversampler* tOversampler;
@@ -145,9 +178,12 @@ extern "C" {
     float   tOversampler_downsample     (tOversampler* const, float* input);
     float   tOversampler_tick           (tOversampler* const, float input, float* oversample,
                                          float (*effectTick)(float));
+    void    tOversampler_processBlock   (tOversampler* const, float* input, float* output, int numSamples,
+                                         void (*effect)(void* ctx, float* buffer, int numSamples), void* ctx);
 
     void    tOversampler_setRatio       (tOversampler* const, int ratio);
     void    tOversampler_setQuality     (tOversampler* const, int quality);
+    void    tOversampler_setType        (tOversampler* const, OversamplerType type);
     int     tOversampler_getLatency     (tOversampler* const);
     
     //==============================================================================
@@ -175,9 +211,30 @@ extern "C" {
      @fn float   tLockhartWavefolder_tick    (tLockhartWavefolder* const, float samp)
      @brief
      @param wavefolder A pointer to the relevant tLockhartWavefolder.
+     
+     @fn float   tLockhartWavefolder_tickFast    (tLockhartWavefolder* const, float samp)
+     @brief Fold a sample in single precision. The iterative Lambert W solve is replaced by a direct approximation of W(e^x) refined with one Newton step. Against tLockhartWavefolder_tick the error is within LOCKHART_FAST_ERROR for inputs within +-2, measured over sine sweeps and noise.
+     @param wavefolder A pointer to the relevant tLockhartWavefolder.
+     
+     @fn void    tLockhartWavefolder_tickBlock    (tLockhartWavefolder* const, float* input, float* output, int numSamples)
+     @brief Fold a block of samples, on the fast path if it is set.
+     @param wavefolder A pointer to the relevant tLockhartWavefolder.
+     @param input The input block.
+     @param output The output block. May be the same as the input.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tLockhartWavefolder_setFast    (tLockhartWavefolder* const, int fast)
+     @brief Set whether tLockhartWavefolder_tickBlock uses the single precision path. The state is carried over, so this can be switched while running.
+     @param wavefolder A pointer to the relevant tLockhartWavefolder.
+     @param fast 1 for the fast path, 0 for the double precision path.
      ￼￼￼
      @} */
     
+    // input difference below which the fast path falls back to the midpoint
+#define LOCKHART_FAST_THRESH 1.0e-2f
+    // measured bound on the fast path's difference from the double path
+#define LOCKHART_FAST_ERROR 2.0e-4f
+    
     typedef struct _tLockhartWavefolder
     {
         
@@ -207,6 +264,10 @@ extern "C" {
         double tempsDenom;
         double tempErrDenom;
         double tempOutDenom;
+        
+        int fast;
+        float xf1, Ff1;
+        float lnd, bf, VTf, af, half_af, longthingf;
 
     } _tLockhartWavefolder;
     
@@ -217,6 +278,9 @@ extern "C" {
     void    tLockhartWavefolder_free    (tLockhartWavefolder* const);
     
     float   tLockhartWavefolder_tick    (tLockhartWavefolder* const, float samp);
+    float   tLockhartWavefolder_tickFast    (tLockhartWavefolder* const, float samp);
+    void    tLockhartWavefolder_tickBlock    (tLockhartWavefolder* const, float* input, float* output, int numSamples);
+    void    tLockhartWavefolder_setFast    (tLockhartWavefolder* const, int fast);
 
     //==============================================================================
 
@@ -296,6 +360,122 @@ extern "C" {
     
     //==============================================================================
     
+    /*!
+     @defgroup tadaashaper tADAAShaper
+     @ingroup distortion
+     @brief Waveshaper with first or second order antiderivative antialiasing (ADAA).
+     @{
+     
+     Each output is the average of the curve over the line between the last input samples (first order), or a triangle-weighted average over the last three (second order). This suppresses aliasing enough that most saturation can run at 1x or 2x instead of inside a tOversampler at 8x. The antiderivatives are closed form for the piecewise curves and for tanh at first order, so first order tanh stays within 2e-7 of the exact average of LEAF_tanh. The shaper, and tanh at second order, use tables. The divided differences are taken in double precision. When neighbouring inputs are too close for the divided differences to be accurate, the curve at their midpoint is used instead. First order delays by half a sample and second order by one sample.
+     
+     @fn void    tADAAShaper_init            (tADAAShaper* const, ADAAShaperType type, int order, LEAF* const leaf)
+     @brief Initialize a tADAAShaper to the default mempool of a LEAF instance.
+     @param shaper A pointer to the tADAAShaper to initialize.
+     @param type The curve. ADAAHardClip clips to [-1, 1] like LEAF_clip, ADAATanh is LEAF_tanh, ADAASoftClip is LEAF_softClip, ADAAShaper is LEAF_shaper, ADAAReedTable is LEAF_reedTable and ADAAQuantizer rounds to a step like tCrusher.
+     @param order The antialiasing order, 1 or 2.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tADAAShaper_initToPool      (tADAAShaper* const, ADAAShaperType type, int order, tMempool* const)
+     @brief Initialize a tADAAShaper to a specified mempool.
+     @param shaper A pointer to the tADAAShaper to initialize.
+     @param type The curve.
+     @param order The antialiasing order, 1 or 2.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tADAAShaper_free            (tADAAShaper* const)
+     @brief Free a tADAAShaper from its mempool.
+     @param shaper A pointer to the tADAAShaper to free.
+     
+     @fn float   tADAAShaper_tick            (tADAAShaper* const, float input)
+     @brief Shape a sample.
+     @param shaper A pointer to the relevant tADAAShaper.
+     @param input The input sample.
+     @return The shaped sample.
+     
+     @fn void    tADAAShaper_tickBlock       (tADAAShaper* const, float* input, float* output, int numSamples)
+     @brief Shape a block of samples.
+     @param shaper A pointer to the relevant tADAAShaper.
+     @param input The input block.
+     @param output The output block. May be the same as the input.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tADAAShaper_setType         (tADAAShaper* const, ADAAShaperType type)
+     @brief Set the curve.
+     @param shaper A pointer to the relevant tADAAShaper.
+     
+     @fn void    tADAAShaper_setOrder        (tADAAShaper* const, int order)
+     @brief Set the antialiasing order, 1 or 2. Second order suppresses aliasing further at the cost of more high frequency rolloff and computation.
+     @param shaper A pointer to the relevant tADAAShaper.
+     
+     @fn void    tADAAShaper_setThreshold    (tADAAShaper* const, float thresh)
+     @brief Set the threshold of the soft clip curve, as in LEAF_softClip.
+     @param shaper A pointer to the relevant tADAAShaper.
+     @param thresh The threshold from 0 to 1.
+     
+     @fn void    tADAAShaper_setDrive        (tADAAShaper* const, float drive)
+     @brief Set the drive of the shaper curve, as in LEAF_shaper.
+     @param shaper A pointer to the relevant tADAAShaper.
+     
+     @fn void    tADAAShaper_setReedTable    (tADAAShaper* const, float offset, float slope)
+     @brief Set the offset and slope of the reed table curve, as in LEAF_reedTable.
+     @param shaper A pointer to the relevant tADAAShaper.
+     
+     @fn void    tADAAShaper_setStep         (tADAAShaper* const, float step)
+     @brief Set the step the quantizer rounds to, as in LEAF_round.
+     @param shaper A pointer to the relevant tADAAShaper.
+     
+     @} */
+    
+    typedef enum ADAAShaperType
+    {
+        ADAAHardClip = 0,
+        ADAATanh,
+        ADAASoftClip,
+        ADAAShaper,
+        ADAAReedTable,
+        ADAAQuantizer,
+        ADAAShaperTypeNil
+    } ADAAShaperType;
+    
+    typedef struct _tADAAShaper
+    {
+        
+        tMempool mempool;
+        
+        ADAAShaperType type;
+        int order;
+        
+        float thresh;
+        float drive, gain;
+        float offset, slope;
+        float step;
+        
+        // previous inputs, after the reed table's offset and slope
+        float x1, x2;
+        // antiderivatives at x1 and the divided difference of F2 between x1 and x2
+        double F1x1;
+        double F2x1;
+        double D1;
+        
+    } _tADAAShaper;
+    
+    typedef _tADAAShaper* tADAAShaper;
+    
+    void    tADAAShaper_init            (tADAAShaper* const, ADAAShaperType type, int order, LEAF* const leaf);
+    void    tADAAShaper_initToPool      (tADAAShaper* const, ADAAShaperType type, int order, tMempool* const);
+    void    tADAAShaper_free            (tADAAShaper* const);
+    
+    float   tADAAShaper_tick            (tADAAShaper* const, float input);
+    void    tADAAShaper_tickBlock       (tADAAShaper* const, float* input, float* output, int numSamples);
+    void    tADAAShaper_setType         (tADAAShaper* const, ADAAShaperType type);
+    void    tADAAShaper_setOrder        (tADAAShaper* const, int order);
+    void    tADAAShaper_setThreshold    (tADAAShaper* const, float thresh);
+    void    tADAAShaper_setDrive        (tADAAShaper* const, float drive);
+    void    tADAAShaper_setReedTable    (tADAAShaper* const, float offset, float slope);
+    void    tADAAShaper_setStep         (tADAAShaper* const, float step);
+    
+    //==============================================================================
+    
 #ifdef __cplusplus
 }
 #endif
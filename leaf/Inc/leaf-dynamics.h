@@ -20,6 +20,7 @@ extern "C" {
 #include "leaf-math.h"
 #include "leaf-mempool.h"
 #include "leaf-analysis.h"
+#include "leaf-delay.h"
     
     /*!
      * @internal
@@ -54,8 +55,37 @@ extern "C" {
      @fn float   tCompressor_tick        (tCompressor* const, float input)
      @brief
      @param compressor A pointer to the relevant tCompressor.
+     
+     @fn void    tCompressor_tickBlock   (tCompressor* const, float* input, float* output, int numSamples)
+     @brief Compress a block of samples. The level detection and gain curve are computed a block at a time with a fast log2 and exp2, in loops the compiler can vectorize, so the gain differs from tCompressor_tick()'s by up to about 0.03 dB.
+     @param compressor A pointer to the relevant tCompressor.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tCompressor_tickBlockLinked (tCompressor* const, float** input, float** output, int numChannels, int numSamples)
+     @brief Compress a block of samples on several channels with one gain, detected from the loudest channel at each sample.
+     @param compressor A pointer to the relevant tCompressor.
+     @param input An array of one input block per channel.
+     @param output An array of one output block per channel. These may be the same as the input blocks.
+     @param numChannels The number of channels.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tCompressor_setParams   (tCompressor* const comp, float thresh, float ratio, float knee, float makeup, float attack, float release)
+     @brief Set all of the compressor's parameters.
+     @param compressor A pointer to the relevant tCompressor.
+     @param thresh The threshold in decibels.
+     @param ratio The compression ratio.
+     @param knee The width of the soft knee in decibels, centered on the threshold. 0 for a hard knee.
+     @param makeup The make-up gain in decibels.
+     @param attack The attack time in milliseconds.
+     @param release The release time in milliseconds.
      ￼￼￼
      @} */
+    
+#ifndef COMPRESSOR_BLOCK_SIZE
+#define COMPRESSOR_BLOCK_SIZE 32
+#endif
    
     typedef struct _tCompressor
     {
@@ -80,9 +110,136 @@ extern "C" {
     void    tCompressor_free        (tCompressor* const);
     
     float   tCompressor_tick        (tCompressor* const, float input);
+    void    tCompressor_tickBlock   (tCompressor* const, float* input, float* output, int numSamples);
+    void    tCompressor_tickBlockLinked (tCompressor* const, float** input, float** output, int numChannels, int numSamples);
 void    tCompressor_setParams   (tCompressor* const comp, float thresh, float ratio, float knee, float makeup, float attack, float release);
     
     
+    //==============================================================================
+    
+    /*!
+     @defgroup tmultibandcompressor tMultibandCompressor
+     @ingroup dynamics
+     @brief Multiband compressor with Linkwitz-Riley crossovers.
+     @details Multiband compressor. The input is split by a chain of 4th order Linkwitz-Riley crossovers, with the bands below each crossover passed through its allpass so that with no compression the bands sum back to an allpassed copy of the input with a flat magnitude response. Each band has its own detector and gain computer, which work like tCompressor's block path. All of the filter and band state is kept in a few contiguous arrays, and the band smoothers run side by side so the compiler can put the bands in SIMD lanes.
+     @{
+     
+     @fn void    tMultibandCompressor_init           (tMultibandCompressor* const, int numBands, LEAF* const leaf)
+     @brief Initialize a tMultibandCompressor to the default mempool of a LEAF instance.
+     @param compressor A pointer to the tMultibandCompressor to initialize.
+     @param numBands The number of bands. The crossovers start spaced evenly in log frequency between 100 Hz and 8 kHz, and the bands start with no compression.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tMultibandCompressor_initToPool     (tMultibandCompressor* const, int numBands, tMempool* const)
+     @brief Initialize a tMultibandCompressor to a specified mempool.
+     @param compressor A pointer to the tMultibandCompressor to initialize.
+     @param numBands The number of bands.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tMultibandCompressor_free           (tMultibandCompressor* const)
+     @brief Free a tMultibandCompressor from its mempool.
+     @param compressor A pointer to the tMultibandCompressor to free.
+     
+     @fn float   tMultibandCompressor_tick           (tMultibandCompressor* const, float input)
+     @brief Compress a sample.
+     @param compressor A pointer to the relevant tMultibandCompressor.
+     @param input The input sample.
+     @return The compressed sample.
+     
+     @fn void    tMultibandCompressor_tickBlock      (tMultibandCompressor* const, float* input, float* output, int numSamples)
+     @brief Compress a block of samples, MULTIBAND_BLOCK_SIZE at a time. Much cheaper per sample than tMultibandCompressor_tick().
+     @param compressor A pointer to the relevant tMultibandCompressor.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tMultibandCompressor_setCrossover   (tMultibandCompressor* const, int crossover, float freq)
+     @brief Set the frequency of a crossover. Crossovers should be kept in increasing order.
+     @param compressor A pointer to the relevant tMultibandCompressor.
+     @param crossover The crossover, from 0 for the one above the lowest band to numBands - 2.
+     @param freq The crossover frequency in Hz.
+     
+     @fn void    tMultibandCompressor_setBandParams  (tMultibandCompressor* const, int band, float thresh, float ratio, float knee, float makeup, float attack, float release)
+     @brief Set the compression of a band, like tCompressor_setParams().
+     @param compressor A pointer to the relevant tMultibandCompressor.
+     @param band The band, from 0 for the lowest.
+     @param thresh The threshold in decibels.
+     @param ratio The compression ratio.
+     @param knee The width of the soft knee in decibels. 0 for a hard knee.
+     @param makeup The make-up gain in decibels.
+     @param attack The attack time in milliseconds.
+     @param release The release time in milliseconds.
+     
+     @fn float   tMultibandCompressor_getGain        (tMultibandCompressor* const, int band)
+     @brief Get the gain most recently applied to a band, for metering.
+     @param compressor A pointer to the relevant tMultibandCompressor.
+     @param band The band.
+     @return The linear gain, including make-up gain.
+     
+     @fn void    tMultibandCompressor_setSampleRate  (tMultibandCompressor* const, float sr)
+     @brief Set the sample rate, keeping the crossover frequencies and time constants.
+     @param compressor A pointer to the relevant tMultibandCompressor.
+     @param sr The new sample rate.
+     
+     @} */
+    
+#ifndef MULTIBAND_BLOCK_SIZE
+#define MULTIBAND_BLOCK_SIZE 32
+#endif
+#ifndef MULTIBAND_LANES
+#define MULTIBAND_LANES 4
+#endif
+    
+    typedef struct _tMultibandCompressor
+    {
+        tMempool mempool;
+        
+        int numBands;
+        int numFilters;
+        
+        // state variable filter state, crossovers first and then allpasses
+        float* ic1eq;
+        float* ic2eq;
+        
+        // per crossover
+        float* freq;
+        float* a1;
+        float* a2;
+        float* a3;
+        
+        // per band
+        float* T;
+        float* R;
+        float* W;
+        float* M;
+        float* tauAttack;
+        float* tauRelease;
+        float* y_T;
+        float* gain;
+        
+        // block buffers
+        float* bands;
+        float* gains;
+        float* rest;
+        
+        float sampleRate, invSampleRate;
+        
+    } _tMultibandCompressor;
+    
+    typedef _tMultibandCompressor* tMultibandCompressor;
+    
+    void    tMultibandCompressor_init           (tMultibandCompressor* const, int numBands, LEAF* const leaf);
+    void    tMultibandCompressor_initToPool     (tMultibandCompressor* const, int numBands, tMempool* const);
+    void    tMultibandCompressor_free           (tMultibandCompressor* const);
+    
+    float   tMultibandCompressor_tick           (tMultibandCompressor* const, float input);
+    void    tMultibandCompressor_tickBlock      (tMultibandCompressor* const, float* input, float* output, int numSamples);
+    void    tMultibandCompressor_setCrossover   (tMultibandCompressor* const, int crossover, float freq);
+    void    tMultibandCompressor_setBandParams  (tMultibandCompressor* const, int band, float thresh, float ratio, float knee, float makeup, float attack, float release);
+    float   tMultibandCompressor_getGain        (tMultibandCompressor* const, int band);
+    void    tMultibandCompressor_setSampleRate  (tMultibandCompressor* const, float sr);
+    
+    
     /*!
      @defgroup tfeedbackleveler tFeedbackLeveler
      @ingroup dynamics
@@ -213,6 +370,159 @@ void    tCompressor_setParams   (tCompressor* const comp, float thresh, float ra
     void   tThreshold_setHigh       (tThreshold* const, float high);
 
 
+    
+    //==============================================================================
+    
+    /*!
+     @defgroup tlimiter tLimiter
+     @ingroup dynamics
+     @brief Lookahead brickwall limiter for any number of linked or independent channels.
+     @details Lookahead brickwall limiter. The audio is delayed by the lookahead time while a sliding maximum of the input level over the same window, kept in a monotonic deque so each sample costs O(1), sets the gain needed to keep the peak under the ceiling. That gain releases exponentially and is smoothed by a moving average the length of the window, so it has ramped all the way down by the time the peak comes out of the delay and the output never exceeds the ceiling. In true peak mode the level is also measured between samples, at 4x, so inter-sample peaks are caught too, at the cost of 6 samples of extra latency.
+     @{
+     
+     @fn void    tLimiter_init           (tLimiter* const, int numChannels, float maxLookahead, LEAF* const leaf)
+     @brief Initialize a tLimiter to the default mempool of a LEAF instance.
+     @param limiter A pointer to the tLimiter to initialize.
+     @param numChannels The number of channels to process.
+     @param maxLookahead The maximum lookahead time in milliseconds. The lookahead starts at this value.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tLimiter_initToPool     (tLimiter* const, int numChannels, float maxLookahead, tMempool* const)
+     @brief Initialize a tLimiter to a specified mempool.
+     @param limiter A pointer to the tLimiter to initialize.
+     @param numChannels The number of channels to process.
+     @param maxLookahead The maximum lookahead time in milliseconds. The lookahead starts at this value.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tLimiter_free           (tLimiter* const)
+     @brief Free a tLimiter from its mempool.
+     @param limiter A pointer to the tLimiter to free.
+     
+     @fn float   tLimiter_tick           (tLimiter* const, float input)
+     @brief Limit a sample of a single channel limiter.
+     @param limiter A pointer to the relevant tLimiter.
+     @param input The input sample.
+     @return The limited sample, delayed by the latency.
+     
+     @fn void    tLimiter_tickFrame      (tLimiter* const, float* frame)
+     @brief Limit one sample of every channel in place.
+     @param limiter A pointer to the relevant tLimiter.
+     @param frame An array of one sample per channel.
+     
+     @fn void    tLimiter_tickBlock      (tLimiter* const, float** input, float** output, int numSamples)
+     @brief Limit a block of samples on every channel. The audio is delayed with tDelay_tickBlock() and the gain is applied per block of up to LIMITER_BLOCK_SIZE samples. The result matches calling tLimiter_tickFrame() on each frame.
+     @param limiter A pointer to the relevant tLimiter.
+     @param input An array of one input block per channel.
+     @param output An array of one output block per channel. These may be the same as the input blocks.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tLimiter_setCeiling     (tLimiter* const, float ceiling)
+     @brief Set the level the output will not exceed.
+     @param limiter A pointer to the relevant tLimiter.
+     @param ceiling The ceiling in decibels.
+     
+     @fn void    tLimiter_setLookahead   (tLimiter* const, float lookahead)
+     @brief Set the lookahead time, which is also the attack time. Changing it jumps the delay and resets the gain smoothing, so it isn't meant to be modulated.
+     @param limiter A pointer to the relevant tLimiter.
+     @param lookahead The lookahead time in milliseconds, up to the maximum given at initialization.
+     
+     @fn void    tLimiter_setRelease     (tLimiter* const, float release)
+     @brief Set the release time.
+     @param limiter A pointer to the relevant tLimiter.
+     @param release The release time constant in milliseconds.
+     
+     @fn void    tLimiter_setLink        (tLimiter* const, int link)
+     @brief Set whether all channels share one gain, driven by the loudest of them, or are limited independently.
+     @param limiter A pointer to the relevant tLimiter.
+     @param link 1 to link the channels, 0 to limit each on its own. Linked by default.
+     
+     @fn void    tLimiter_setTruePeak    (tLimiter* const, int truePeak)
+     @brief Set whether peaks between samples are detected. Adds 6 samples of latency. On band-limited material the measured true peaks stay within about 0.1 dB of the ceiling.
+     @param limiter A pointer to the relevant tLimiter.
+     @param truePeak 1 to detect true peaks, 0 for sample peaks only.
+     
+     @fn int     tLimiter_getLatency     (tLimiter* const)
+     @brief Get the delay of the limited output relative to the input.
+     @param limiter A pointer to the relevant tLimiter.
+     @return The latency in samples.
+     
+     @fn float   tLimiter_getGain        (tLimiter* const, int channel)
+     @brief Get the gain most recently applied to a channel.
+     @param limiter A pointer to the relevant tLimiter.
+     @param channel The channel.
+     @return The linear gain.
+     
+     @fn void    tLimiter_setSampleRate  (tLimiter* const, float sr)
+     @brief Set the sample rate. The lookahead is limited to the number of samples allocated at initialization.
+     @param limiter A pointer to the relevant tLimiter.
+     @param sr The new sample rate.
+     
+     @} */
+    
+#ifndef LIMITER_BLOCK_SIZE
+#define LIMITER_BLOCK_SIZE 32
+#endif
+#define LIMITER_TRUE_PEAK_TAPS 12
+#define LIMITER_TRUE_PEAK_PHASES 4
+#define LIMITER_UNITY 16777216 // fixed point gain of 1
+    
+    typedef struct _tLimiter
+    {
+        tMempool mempool;
+        
+        int numChannels;
+        int numGroups; // one gain per group, 1 when linked
+        int link, truePeak;
+        
+        float ceiling;
+        float lookaheadMs, releaseMs, releaseCoeff;
+        float sampleRate;
+        
+        int window, maxWindow; // lookahead + 1 samples
+        float invWindow; // 1 / (window * LIMITER_UNITY)
+        uint32_t count;
+        int pos;
+        
+        tDelay* delays;
+        
+        // per group sliding maximum, as rings of maxWindow
+        uint32_t* dequeIndex;
+        float* dequeValue;
+        int* dequeHead;
+        int* dequeSize;
+        
+        // per group gain smoothing
+        uint32_t* history;
+        uint64_t* sum;
+        float* held;
+        float* gain;
+        float* gainBlock;
+        
+        // per channel recent input for the true peak interpolator
+        float* recent;
+        float* lastSegment;
+        float coeffs[(LIMITER_TRUE_PEAK_PHASES - 1) * LIMITER_TRUE_PEAK_TAPS];
+        float* peak;
+        
+    } _tLimiter;
+    
+    typedef _tLimiter* tLimiter;
+    
+    void    tLimiter_init           (tLimiter* const, int numChannels, float maxLookahead, LEAF* const leaf);
+    void    tLimiter_initToPool     (tLimiter* const, int numChannels, float maxLookahead, tMempool* const);
+    void    tLimiter_free           (tLimiter* const);
+    
+    float   tLimiter_tick           (tLimiter* const, float input);
+    void    tLimiter_tickFrame      (tLimiter* const, float* frame);
+    void    tLimiter_tickBlock      (tLimiter* const, float** input, float** output, int numSamples);
+    void    tLimiter_setCeiling     (tLimiter* const, float ceiling);
+    void    tLimiter_setLookahead   (tLimiter* const, float lookahead);
+    void    tLimiter_setRelease     (tLimiter* const, float release);
+    void    tLimiter_setLink        (tLimiter* const, int link);
+    void    tLimiter_setTruePeak    (tLimiter* const, int truePeak);
+    int     tLimiter_getLatency     (tLimiter* const);
+    float   tLimiter_getGain        (tLimiter* const, int channel);
+    void    tLimiter_setSampleRate  (tLimiter* const, float sr);
 
     //////======================================================================
 
@@ -87,9 +87,34 @@ extern "C" {
      @fn float   tWDF_getCurrent             (tWDF* const)
      @brief
      @param wdf A pointer to the relevant tWDF.
+     
+     @fn float   tWDF_setDiodeTable          (tWDF* const, float range, float tolerance)
+     @brief Replace the per-sample Wright omega solve of a Diode or DiodePair root with a piecewise cubic Hermite table of its reflected wave.
+     The table is built for the current port resistance, and building it allocates and runs thousands of exact solves, so it never happens on the audio path. When the port resistance changes, through a tick with paramsChanged set or tWDFProgram_setValue(), the exact solve is used until tWDF_updateDiodeTable() is called from the control path. The knot count starts at WDF_TABLE_MIN_SIZE and doubles until the measured error is at most the tolerance or WDF_TABLE_MAX_SIZE is reached. The error is measured against the exact solve at three points inside every segment, so it is an estimate, not a guaranteed bound: the largest error between those points can be higher, by up to about 1.4 times in a dense scan of the diode clipper in Examples/wdf-diode-table.c. Pass a tighter tolerance if the error must stay under a hard limit. Incident waves outside the range fall back to the exact solve.
+     @param wdf A pointer to the relevant tWDF.
+     @param range The table covers incident waves from -range to range, in volts.
+     @param tolerance The largest acceptable error in the reflected wave, in volts.
+     @return The measured error of the table.
+     
+     @fn float   tWDF_updateDiodeTable       (tWDF* const)
+     @brief Rebuild a diode table whose port resistance has changed since it was built, with the range and tolerance it was set up with. Call it from the control path or a non-audio thread, never while the tree or its tWDFProgram is being ticked.
+     @param wdf A pointer to the relevant tWDF.
+     @return The measured error of the current table.
+     
+     @fn void    tWDF_disableDiodeTable      (tWDF* const)
+     @brief Free a diode table and go back to the exact solve.
+     @param wdf A pointer to the relevant tWDF.
+     
+     @fn float   tWDF_getDiodeTableError     (tWDF* const)
+     @brief Get the measured error of the current diode table.
+     @param wdf A pointer to the relevant tWDF.
+     @return The largest error found when the table was last built, or 0 if there is no table.
       
      @} */
     
+#define WDF_TABLE_MIN_SIZE 16
+#define WDF_TABLE_MAX_SIZE 4096
+    
     typedef enum WDFComponentType
     {
         SeriesAdaptor = 0,
@@ -134,6 +159,13 @@ extern "C" {
         float (*get_reflected_wave_up)(tWDF* const, float);
         float (*get_reflected_wave_down)(tWDF* const, float, float);
         void (*set_incident_wave)(tWDF* const, float, float);
+        
+        // optional lookup for Diode and DiodePair roots, pairs of value and
+        // slope per knot
+        float* table;
+        int table_size;
+        float table_min, table_range, table_scale;
+        float table_tolerance, table_error, table_resistance;
     };
     
     //WDF Linear Components
@@ -155,6 +187,138 @@ extern "C" {
     float   tWDF_getVoltage             (tWDF* const);
     float   tWDF_getCurrent             (tWDF* const);
     
+    float   tWDF_setDiodeTable          (tWDF* const, float range, float tolerance);
+    float   tWDF_updateDiodeTable       (tWDF* const);
+    void    tWDF_disableDiodeTable      (tWDF* const);
+    float   tWDF_getDiodeTableError     (tWDF* const);
+    
+    //==============================================================================
+    
+    /*!
+     @defgroup twdfprogram tWDFProgram
+     @ingroup electrical
+     @brief A tWDF tree compiled into a flat array of ops for fast ticking.
+     Compiling walks the tree once and orders its nodes so that children come before their parents. Each node becomes an op with precomputed port resistance and scattering coefficients. A tick is then two tight loops over the ops, one up and one down, with no recursion or function pointers.
+     While the program runs, wave state lives in the program and the tWDF nodes themselves are not updated; read voltages and currents with tWDFProgram_getVoltage() and tWDFProgram_getCurrent().
+     @{
+     
+     @fn void    tWDFProgram_init            (tWDFProgram* const, tWDF* const root, tWDF* const outputPoint, LEAF* const leaf)
+     @brief Initialize a tWDFProgram to the default mempool of a LEAF instance and compile a tWDF tree into it.
+     @param program A pointer to the tWDFProgram to initialize.
+     @param root The root of the tree: an IdealSource, Diode or DiodePair.
+     @param outputPoint The node whose voltage is returned by tick.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tWDFProgram_initToPool      (tWDFProgram* const, tWDF* const root, tWDF* const outputPoint, tMempool* const)
+     @brief Initialize a tWDFProgram to a specified mempool and compile a tWDF tree into it.
+     @param program A pointer to the tWDFProgram to initialize.
+     @param root The root of the tree: an IdealSource, Diode or DiodePair.
+     @param outputPoint The node whose voltage is returned by tick.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tWDFProgram_free            (tWDFProgram* const)
+     @brief Free a tWDFProgram from its mempool. The tWDF tree is left untouched.
+     @param program A pointer to the tWDFProgram to free.
+     
+     @fn void    tWDFProgram_compile         (tWDFProgram* const)
+     @brief Recompile the tree, picking up changes to its structure or to values set directly with tWDF_setValue(). Components the program was already running keep their wave state, and new ones take theirs from the tree, so recompiling mid-stream is continuous.
+     @param program A pointer to the relevant tWDFProgram.
+     
+     @fn float   tWDFProgram_tick            (tWDFProgram* const, float sample)
+     @brief Tick the circuit.
+     @param program A pointer to the relevant tWDFProgram.
+     @param sample The input to the sources.
+     @return The voltage at the output point.
+     
+     @fn void    tWDFProgram_tickBlock       (tWDFProgram* const, float* input, float* output, int numSamples)
+     @brief Tick the circuit over a block.
+     @param program A pointer to the relevant tWDFProgram.
+     @param input The input block.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tWDFProgram_setValue        (tWDFProgram* const, tWDF* const component, float value)
+     @brief Set the value of a component in the compiled tree. Only the coefficients on the path from the component to the root are recomputed. A diode table at the root falls back to the exact solve until tWDF_updateDiodeTable() rebuilds it.
+     @param program A pointer to the relevant tWDFProgram.
+     @param component The component to change.
+     @param value The new value.
+     
+     @fn void    tWDFProgram_setOutputPoint  (tWDFProgram* const, tWDF* const outputPoint)
+     @brief Set the node whose voltage is returned by tick.
+     @param program A pointer to the relevant tWDFProgram.
+     @param outputPoint A node in the compiled tree.
+     
+     @fn float   tWDFProgram_getVoltage      (tWDFProgram* const, tWDF* const node)
+     @brief Get the voltage across a node after the last tick.
+     @param program A pointer to the relevant tWDFProgram.
+     @param node A node in the compiled tree.
+     @return The voltage.
+     
+     @fn float   tWDFProgram_getCurrent      (tWDFProgram* const, tWDF* const node)
+     @brief Get the current through a node after the last tick.
+     @param program A pointer to the relevant tWDFProgram.
+     @param node A node in the compiled tree.
+     @return The current.
+     
+     @fn void    tWDFProgram_setSampleRate   (tWDFProgram* const, float sample_rate)
+     @brief Set the sample rate of every node in the tree and recompute the coefficients.
+     @param program A pointer to the relevant tWDFProgram.
+     @param sample_rate The new sample rate.
+     
+     @} */
+    
+    typedef struct _tWDFOp
+    {
+        WDFComponentType type;
+        int parent, left, right;
+        float sign; // -1 for inductors, which store their incident wave inverted
+        float port_resistance, port_conductance;
+        // up: b = up_left * b[left] + up_right * b[right] + up_state * a + up_input * input
+        float up_left, up_right, up_state, up_input;
+        // down: a[child] = down[0] * b[left] + down[1] * b[right] + down[2] * a
+        float down_left[3], down_right[3];
+    } tWDFOp;
+    
+    typedef struct _tWDFProgram
+    {
+        tMempool mempool;
+        
+        tWDF* root;
+        tWDF* output;
+        
+        int numOps;
+        tWDFOp* ops;
+        _tWDF** nodes;
+        
+        // adaptors in parent-before-child order for the down pass
+        int numScatter;
+        int* scatter;
+        
+        // wave arrays hold one slot per op, a zero slot for leaves' missing
+        // children, and a slot for the root
+        float* a;
+        float* b;
+        int nullIndex, rootIndex, childIndex, outputIndex;
+        
+        WDFComponentType rootType;
+        float root_resistance;
+    } _tWDFProgram;
+    
+    typedef _tWDFProgram* tWDFProgram;
+    
+    void    tWDFProgram_init            (tWDFProgram* const, tWDF* const root, tWDF* const outputPoint, LEAF* const leaf);
+    void    tWDFProgram_initToPool      (tWDFProgram* const, tWDF* const root, tWDF* const outputPoint, tMempool* const);
+    void    tWDFProgram_free            (tWDFProgram* const);
+    
+    void    tWDFProgram_compile         (tWDFProgram* const);
+    float   tWDFProgram_tick            (tWDFProgram* const, float sample);
+    void    tWDFProgram_tickBlock       (tWDFProgram* const, float* input, float* output, int numSamples);
+    void    tWDFProgram_setValue        (tWDFProgram* const, tWDF* const component, float value);
+    void    tWDFProgram_setOutputPoint  (tWDFProgram* const, tWDF* const outputPoint);
+    float   tWDFProgram_getVoltage      (tWDFProgram* const, tWDF* const node);
+    float   tWDFProgram_getCurrent      (tWDFProgram* const, tWDF* const node);
+    void    tWDFProgram_setSampleRate   (tWDFProgram* const, float sample_rate);
+    
     
     //==============================================================================
     
@@ -74,6 +74,17 @@ extern "C" {
      @brief
      @param envelope A pointer to the relevant tEnvelope.
      
+     @fn void    tEnvelope_tickBlock      (tEnvelope* const, float* output, int numSamples)
+     @brief Render a block at control rate. The envelope advances once every control period and the samples in between are linearly interpolated.
+     @param envelope A pointer to the relevant tEnvelope.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tEnvelope_setControlRate (tEnvelope* const, int controlRate)
+     @brief Set the control period of tEnvelope_tickBlock in samples. 0 follows the LEAF control rate.
+     @param envelope A pointer to the relevant tEnvelope.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tEnvelope
@@ -97,6 +108,9 @@ extern "C" {
         
         float attackPhase, decayPhase, rampPhase;
         
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tEnvelope;
     
     typedef _tEnvelope* tEnvelope;
@@ -106,10 +120,12 @@ extern "C" {
     void    tEnvelope_free          (tEnvelope* const);
     
     float   tEnvelope_tick          (tEnvelope* const);
+    void    tEnvelope_tickBlock      (tEnvelope* const, float* output, int numSamples);
     void    tEnvelope_setAttack     (tEnvelope* const, float attack);
     void    tEnvelope_setDecay      (tEnvelope* const, float decay);
     void    tEnvelope_loop          (tEnvelope* const, int loop);
     void    tEnvelope_on            (tEnvelope* const, float velocity);
+    void    tEnvelope_setControlRate (tEnvelope* const, int controlRate);
     
     // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
     
@@ -158,6 +174,17 @@ extern "C" {
      @brief
      @param smooth A pointer to the relevant tExpSmooth.
      
+     @fn void    tExpSmooth_tickBlock      (tExpSmooth* const, float* output, int numSamples)
+     @brief Render a block at control rate. The smoother advances once every control period and the samples in between are linearly interpolated.
+     @param smooth A pointer to the relevant tExpSmooth.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tExpSmooth_setControlRate (tExpSmooth* const, int controlRate)
+     @brief Set the control period of tExpSmooth_tickBlock in samples. 0 follows the LEAF control rate.
+     @param smooth A pointer to the relevant tExpSmooth.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tExpSmooth
@@ -167,6 +194,9 @@ extern "C" {
         float baseFactor, factor, oneminusfactor;
         float curr,dest;
         float invSampleRate;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tExpSmooth;
     
     typedef _tExpSmooth* tExpSmooth;
@@ -176,12 +206,14 @@ extern "C" {
     void    tExpSmooth_free         (tExpSmooth* const);
     
     float   tExpSmooth_tick         (tExpSmooth* const);
+    void    tExpSmooth_tickBlock      (tExpSmooth* const, float* output, int numSamples);
     float   tExpSmooth_sample       (tExpSmooth* const);
     void    tExpSmooth_setFactor    (tExpSmooth* const, float factor);
     void    tExpSmooth_setDest      (tExpSmooth* const, float dest);
     void    tExpSmooth_setVal       (tExpSmooth* const, float val);
     void    tExpSmooth_setValAndDest(tExpSmooth* const, float val);
     void    tExpSmooth_setSampleRate(tExpSmooth* const, float sr);
+    void    tExpSmooth_setControlRate (tExpSmooth* const, int controlRate);
     
     // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
     
@@ -343,6 +375,17 @@ extern "C" {
      @brief
      @param adsr A pointer to the relevant tADSRT.
      
+     @fn void    tADSRT_tickBlock      (tADSRT* const, float* output, int numSamples)
+     @brief Render a block at control rate. The envelope advances once every control period and the samples in between are linearly interpolated.
+     @param adsr A pointer to the relevant tADSRT.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tADSRT_setControlRate (tADSRT* const, int controlRate)
+     @brief Set the control period of tADSRT_tickBlock in samples. 0 follows the LEAF control rate.
+     @param adsr A pointer to the relevant tADSRT.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tADSRT
@@ -368,6 +411,9 @@ extern "C" {
         float baseLeakFactor, leakFactor;
         
         float invSampleRate;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tADSRT;
     
     typedef _tADSRT* tADSRT;
@@ -378,6 +424,7 @@ extern "C" {
     
     float   tADSRT_tick          (tADSRT* const);
     float   tADSRT_tickNoInterp  (tADSRT* const adsrenv);
+    void    tADSRT_tickBlock      (tADSRT* const, float* output, int numSamples);
     void    tADSRT_setAttack     (tADSRT* const, float attack);
     void    tADSRT_setDecay      (tADSRT* const, float decay);
     void    tADSRT_setSustain    (tADSRT* const, float sustain);
@@ -386,6 +433,7 @@ extern "C" {
     void    tADSRT_on            (tADSRT* const, float velocity);
     void    tADSRT_off           (tADSRT* const);
     void    tADSRT_setSampleRate (tADSRT* const, float sr);
+    void    tADSRT_setControlRate (tADSRT* const, int controlRate);
     
     // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
     
@@ -501,6 +549,139 @@ extern "C" {
     
     // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
     
+    /*!
+     @defgroup tadsrbank tADSRBank
+     @ingroup envelopes
+     @brief A bank of tADSRS envelopes for a polyphonic voice pool, sharing one set of times and rendering every voice in blocks.
+     @{
+     
+     @fn void    tADSRBank_init          (tADSRBank* const, int numVoices, float attack, float decay, float sustain, float release, LEAF* const leaf)
+     @brief Initialize a tADSRBank to the default mempool of a LEAF instance.
+     @param bank A pointer to the tADSRBank to initialize.
+     @param numVoices The number of voices.
+     @param attack The attack time in ms.
+     @param decay The decay time in ms.
+     @param sustain The sustain level from 0 to 1.
+     @param release The release time in ms.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tADSRBank_initToPool    (tADSRBank* const, int numVoices, float attack, float decay, float sustain, float release, tMempool* const)
+     @brief Initialize a tADSRBank to a specified mempool.
+     @param bank A pointer to the tADSRBank to initialize.
+     @param numVoices The number of voices.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tADSRBank_free          (tADSRBank* const)
+     @brief Free a tADSRBank from its mempool.
+     @param bank A pointer to the tADSRBank to free.
+     
+     @fn void    tADSRBank_tick          (tADSRBank* const, float* output)
+     @brief Tick every voice once.
+     @param bank A pointer to the relevant tADSRBank.
+     @param output An array of numVoices envelope values.
+     
+     @fn void    tADSRBank_tickBlock     (tADSRBank* const, float** output, int numSamples)
+     @brief Render a block of envelope values for every voice. Each voice matches a tADSRS with the same settings sample for sample.
+     
+     Every stage is a one-pole segment, so on entering a stage the number of samples before it can reach its threshold is worked out in closed form. All voices then run the shortest of those spans without testing their stage, and only voices at the end of their span are checked.
+     @param bank A pointer to the relevant tADSRBank.
+     @param output An array of numVoices output blocks. A NULL block is skipped.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tADSRBank_on            (tADSRBank* const, int voice, float velocity)
+     @brief Start the attack of a voice.
+     @param bank A pointer to the relevant tADSRBank.
+     @param voice The index of the voice, from 0 to numVoices - 1. Other indices are ignored.
+     @param velocity The velocity from 0 to 1.
+     
+     @fn void    tADSRBank_off           (tADSRBank* const, int voice)
+     @brief Start the release of a voice.
+     @param bank A pointer to the relevant tADSRBank.
+     @param voice The index of the voice, from 0 to numVoices - 1. Other indices are ignored.
+     
+     @fn int     tADSRBank_isActive      (tADSRBank* const, int voice)
+     @brief Check whether a voice is still sounding.
+     @param bank A pointer to the relevant tADSRBank.
+     @param voice The index of the voice, from 0 to numVoices - 1. Other indices are ignored.
+     @return 1 if the voice is not idle, 0 otherwise or for an index out of range.
+     
+     @fn void    tADSRBank_setAttack     (tADSRBank* const, float attack)
+     @brief Set the attack time in ms for every voice.
+     @param bank A pointer to the relevant tADSRBank.
+     
+     @fn void    tADSRBank_setDecay      (tADSRBank* const, float decay)
+     @brief Set the decay time in ms for every voice.
+     @param bank A pointer to the relevant tADSRBank.
+     
+     @fn void    tADSRBank_setSustain    (tADSRBank* const, float sustain)
+     @brief Set the sustain level for every voice.
+     @param bank A pointer to the relevant tADSRBank.
+     
+     @fn void    tADSRBank_setRelease    (tADSRBank* const, float release)
+     @brief Set the release time in ms for every voice.
+     @param bank A pointer to the relevant tADSRBank.
+     
+     @fn void    tADSRBank_setLeakFactor (tADSRBank* const, float leakFactor)
+     @brief Set the leak factor for every voice. 0.999999 is a slow leak, 0.9 is fast.
+     @param bank A pointer to the relevant tADSRBank.
+     
+     @} */
+    
+#define ADSRBANK_LANES 8
+#define ADSRBANK_CHUNK 64
+    
+    typedef struct _tADSRBank
+    {
+        tMempool mempool;
+        
+        int numVoices;
+        int numLanes;
+        
+        // per-voice state, carved from one allocation and padded to ADSRBANK_LANES
+        float* voices;
+        float* output;
+        float* gain;
+        float* targetGainSquared;
+        float* base;
+        float* coef;
+        float* mul;
+        int* stage;
+        int* remaining;
+        
+        float* scratch;
+        
+        float sampleRate;
+        float sampleRateInMs;
+        float attack, decay, release;
+        float attackCoef, decayCoef, releaseCoef;
+        float attackBase, decayBase, releaseBase;
+        float sustainLevel;
+        float targetRatioA, targetRatioDR;
+        float baseLeakFactor, leakFactor;
+        float factor, oneMinusFactor;
+        float invSampleRate;
+    } _tADSRBank;
+    
+    typedef _tADSRBank* tADSRBank;
+    
+    void    tADSRBank_init          (tADSRBank* const, int numVoices, float attack, float decay, float sustain, float release, LEAF* const leaf);
+    void    tADSRBank_initToPool    (tADSRBank* const, int numVoices, float attack, float decay, float sustain, float release, tMempool* const);
+    void    tADSRBank_free          (tADSRBank* const);
+    
+    void    tADSRBank_tick          (tADSRBank* const, float* output);
+    void    tADSRBank_tickBlock     (tADSRBank* const, float** output, int numSamples);
+    void    tADSRBank_on            (tADSRBank* const, int voice, float velocity);
+    void    tADSRBank_off           (tADSRBank* const, int voice);
+    int     tADSRBank_isActive      (tADSRBank* const, int voice);
+    void    tADSRBank_setAttack     (tADSRBank* const, float attack);
+    void    tADSRBank_setDecay      (tADSRBank* const, float decay);
+    void    tADSRBank_setSustain    (tADSRBank* const, float sustain);
+    void    tADSRBank_setRelease    (tADSRBank* const, float release);
+    void    tADSRBank_setLeakFactor (tADSRBank* const, float leakFactor);
+    void    tADSRBank_setSampleRate (tADSRBank* const, float sr);
+    
+    // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
+    
     /*!
      @defgroup tramp tRamp
      @ingroup envelopes
@@ -541,6 +722,17 @@ extern "C" {
      @brief
      @param ramp A pointer to the relevant tRamp.
      
+     @fn void    tRamp_tickBlock      (tRamp* const, float* output, int numSamples)
+     @brief Render a block at control rate. The ramp advances once every control period and the samples in between are linearly interpolated.
+     @param ramp A pointer to the relevant tRamp.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tRamp_setControlRate (tRamp* const, int controlRate)
+     @brief Set the control period of tRamp_tickBlock in samples. 0 follows the LEAF control rate.
+     @param ramp A pointer to the relevant tRamp.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tRamp
@@ -554,6 +746,9 @@ extern "C" {
         float time;
         float factor;
         int samples_per_tick;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tRamp;
     
     typedef _tRamp* tRamp;
@@ -563,11 +758,13 @@ extern "C" {
     void    tRamp_free          (tRamp* const);
     
     float   tRamp_tick          (tRamp* const);
+    void    tRamp_tickBlock      (tRamp* const, float* output, int numSamples);
     float   tRamp_sample        (tRamp* const);
     void    tRamp_setTime       (tRamp* const, float time);
     void    tRamp_setDest       (tRamp* const, float dest);
     void    tRamp_setVal        (tRamp* const, float val);
     void    tRamp_setSampleRate (tRamp* const, float sr);
+    void    tRamp_setControlRate (tRamp* const, int controlRate);
     
     /*!
      @defgroup trampupdown tRampUpDown
@@ -683,6 +880,17 @@ extern "C" {
      @brief
      @param slide A pointer to the relevant tSlide.
      
+     @fn void    tSlide_tickBlock      (tSlide* const, float* output, int numSamples)
+     @brief Render a block at control rate. The slide, heading for the value set with tSlide_setDest(), advances once every control period and the samples in between are linearly interpolated.
+     @param slide A pointer to the relevant tSlide.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tSlide_setControlRate (tSlide* const, int controlRate)
+     @brief Set the control period of tSlide_tickBlock in samples. 0 follows the LEAF control rate.
+     @param slide A pointer to the relevant tSlide.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tSlide
@@ -694,6 +902,9 @@ extern "C" {
         float invUpSlide;
         float invDownSlide;
         float dest;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tSlide;
     
     typedef _tSlide* tSlide;
@@ -704,9 +915,11 @@ extern "C" {
     
     float   tSlide_tick         (tSlide* const, float in);
     float   tSlide_tickNoInput    (tSlide* const sl);
+    void    tSlide_tickBlock      (tSlide* const, float* output, int numSamples);
     void    tSlide_setUpSlide    (tSlide* const sl, float upSlide);
     void    tSlide_setDownSlide    (tSlide* const sl, float downSlide);
     void    tSlide_setDest        (tSlide* const sl, float dest);
+    void    tSlide_setControlRate (tSlide* const, int controlRate);
     
 #ifdef __cplusplus
 }
@@ -23,6 +23,28 @@ extern "C" {
 #include "../leaf-config.h"
 #endif
     
+    /*!
+     * @ingroup leaf
+     * @brief Accuracy/speed tiers for the math inside tSVF, tVZFilter, tDiodeFilter and tNeuron. See LEAF_setQuality().
+     */
+    typedef enum LEAFQuality
+    {
+        LEAFQualityHigh = 0, //!< libm functions.
+        LEAFQualityBalanced, //!< Approximations within about 1e-5 of libm.
+        LEAFQualityFast, //!< Cheapest approximations, within about 1e-2 of libm.
+        LEAFQualityNil
+    } LEAFQuality;
+    
+    /*!
+     * @ingroup leaf
+     * @brief Floating-point control state saved by LEAF_DenormalGuard_begin() and restored by LEAF_DenormalGuard_end().
+     */
+    typedef struct LEAF_DenormalGuard
+    {
+        unsigned long long state; //!< The MXCSR, FPCR or FPSCR value from before the guard began.
+        int active; //!< Whether flush-to-zero was set by this guard.
+    } LEAF_DenormalGuard;
+    
     /*!
      * @ingroup leaf
      * @brief Struct for an instance of LEAF.
@@ -34,6 +56,8 @@ extern "C" {
         float   sampleRate; //!< The current audio sample rate. Set with LEAF_setSampleRate().
         float   invSampleRate; //!< The inverse of the current sample rate.
         int     blockSize; //!< The audio block size.
+        int     controlRate; //!< The number of samples per control-rate update for objects rendered with a control-rate tickBlock. Set with LEAF_setControlRate().
+        LEAFQuality quality; //!< The approximation tier used by objects allocated from this instance. Set with LEAF_setQuality().
         float   twoPiTimesInvSampleRate; //!<  Two-pi times the inverse of the current sample rate.
         float   (*random)(void); //!< A pointer to the random() function provided on initialization.
         int     clearOnAllocation; //!< A flag that determines whether memory allocated from the LEAF memory pool will be cleared.
@@ -47,6 +71,13 @@ extern "C" {
         ///@}
     };
     
+    // the tier objects should use, a constant when LEAF_FIXED_QUALITY is set
+#if LEAF_FIXED_QUALITY >= 0
+#define LEAF_QUALITY(leaf) ((LEAFQuality) LEAF_FIXED_QUALITY)
+#else
+#define LEAF_QUALITY(leaf) ((leaf)->quality)
+#endif
+    
     //==============================================================================
     
 #ifdef __cplusplus
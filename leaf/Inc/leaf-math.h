@@ -137,6 +137,9 @@ extern "C" {
     float LEAF_interpolate_hermite_x(float yy0, float yy1, float yy2, float yy3, float xx);
     float LEAF_interpolation_linear (float A, float B, float t);
     
+    // Control-rate ramp: steps *value by inc for up to *count samples, returns the number written
+    int LEAF_controlRamp (float* output, int numSamples, float* value, float inc, int* count);
+    
     float interpolate3max(float *buf, const int peakindex);
     float interpolate3phase(float *buf, const int peakindex);
     
@@ -173,6 +176,20 @@ extern "C" {
     float fast_tanh2(float x);
     float fast_tanh3(float x);
     float fast_tanh4(float x);
+    
+    // Tiered forms picked by LEAFQuality (see LEAF_setQuality()). Errors are the max
+    // against double precision; High is libm.
+    
+    // tan() for prewarping, |x| < pi/2. Balanced reflects fasttanf() about pi/4, relative
+    // error 4e-4 (cutoff error 2e-7). Fast is a [3/2] Pade, cutoff error 0.5% at 0.95 Nyquist.
+    float LEAF_tanQuality (float x, LEAFQuality quality);
+    // tanh(). Balanced goes through fastexp2f(), absolute error 1.8e-6. Fast is fast_tanh()
+    // clipped to +-1 past +-4.97, absolute error 9.6e-5.
+    float LEAF_tanhQuality (float x, LEAFQuality quality);
+    // exp2(). Balanced is fastexp2f(), relative error 3.8e-6. Fast is a cubic, relative error 3e-4.
+    float LEAF_exp2Quality (float x, LEAFQuality quality);
+    // exp() through LEAF_exp2Quality(), same relative errors.
+    float LEAF_expQuality (float x, LEAFQuality quality);
 
     //0.001 base gives a good curve that goes from 1 to near zero
     //1000 gives a good curve from -1.0 to 0.0
@@ -234,6 +251,33 @@ extern "C" {
     int popcount(unsigned int x);
     
     float median3f(float a, float b, float c);
+    
+    // smallest power of two greater than or equal to x, for sizing masked ring buffers
+    uint32_t LEAF_nextPowerOfTwo(uint32_t x);
+    
+    // Array forms of the approximations above, vectorized with SSE2 or AVX2 when
+    // available (see LEAF_USE_SIMD), NEON when LEAF_USE_NEON is also set, and plain
+    // loops otherwise. in and out
+    // may be the same array. Max errors are measured against double precision.
+    
+    // fastexp2f(). Relative error 3.4e-6, input clipped to [-126, 126].
+    void LEAF_exp2_block (const float* in, float* out, int n);
+    // log2f_approx(). Absolute error 1.3e-3 for normal positive inputs.
+    void LEAF_log2_block (const float* in, float* out, int n);
+    // dbtoa() through the exp2 above. Relative error 6.2e-6 (0.00005 dB), input clipped to [-758, 758] dB.
+    void LEAF_dbtoa_block (const float* in, float* out, int n);
+    // atodb() through the log2 above. Absolute error 0.008 dB.
+    void LEAF_atodb_block (const float* in, float* out, int n);
+    // mtof() through the exp2 above. Relative error 7e-6 (0.012 cents), input clipped to [-1500, 1499].
+    void LEAF_mtof_block (const float* in, float* out, int n);
+    // LEAF_tanh(). Absolute error 0.024 against tanh, and it is exactly +-1 beyond +-3.
+    void LEAF_tanh_block (const float* in, float* out, int n);
+    // fastcosf(). Absolute error 1.2e-7 on [-pi/2, pi/2], 7.6e-4 on [-pi, pi].
+    void LEAF_cos_block (const float* in, float* out, int n);
+    // fasttanf(). Absolute error 1.2e-7 on [-pi/4, pi/4], 0.023 on [-1.2, 1.2].
+    void LEAF_tan_block (const float* in, float* out, int n);
+    // LEAF_interpolate_hermite() on arrays of points and positions. Matches it to 6e-7.
+    void LEAF_interpolate_hermite_block (const float* A, const float* B, const float* C, const float* D, const float* alpha, float* out, int n);
 
 #ifdef ITCMRAM
 void __attribute__ ((section(".itcmram"))) __attribute__ ((aligned (32))) place_step_dd(float *buffer, int index, float phase, float w, float scale);
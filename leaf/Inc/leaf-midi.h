@@ -429,6 +429,451 @@ extern "C" {
     int     tSimplePoly_getPitchAndCheckActive(tSimplePoly* const polyh, uint8_t voice);
     int     tSimplePoly_getVelocity           (tSimplePoly* const poly, uint8_t voice);
     int     tSimplePoly_isOn                  (tSimplePoly* const poly, uint8_t voice);
+    
+    //==============================================================================
+    
+    /*!
+     @defgroup tvoiceallocator tVoiceAllocator
+     @ingroup midi
+     @brief Constant-time voice allocator with the note and stealing behavior of tPoly.
+     @{
+     
+     New notes take the lowest free voice. When no voice is free the oldest sounding note is stolen and waits, and when a voice is released it goes to the most recent waiting note, as in tPoly. Free voices are kept in a bitset, held notes in a linked list in note-on order and notes map directly to voices, so note on and note off take constant time however many notes are held. Glide and pitch bend are left to the caller.
+     
+     @fn void    tVoiceAllocator_init              (tVoiceAllocator* const, int maxNumVoices, LEAF* const leaf)
+     @brief Initialize a tVoiceAllocator to the default mempool of a LEAF instance.
+     @param allocator A pointer to the tVoiceAllocator to initialize.
+     @param maxNumVoices The maximum number of voices.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tVoiceAllocator_initToPool        (tVoiceAllocator* const, int maxNumVoices, tMempool* const)
+     @brief Initialize a tVoiceAllocator to a specified mempool.
+     @param allocator A pointer to the tVoiceAllocator to initialize.
+     @param maxNumVoices The maximum number of voices.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tVoiceAllocator_free              (tVoiceAllocator* const)
+     @brief Free a tVoiceAllocator from its mempool.
+     @param allocator A pointer to the tVoiceAllocator to free.
+     
+     @fn int     tVoiceAllocator_noteOn            (tVoiceAllocator* const, int note, uint8_t vel)
+     @brief Add a note, stealing the voice of the oldest sounding note if none is free.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     @param note The MIDI note number to add.
+     @param vel The MIDI velocity of the note to add.
+     @return The voice that will play the note, or -1 if the note was already held or there are no voices.
+     
+     @fn int     tVoiceAllocator_noteOff           (tVoiceAllocator* const, int note)
+     @brief Remove a note. If a stolen note is waiting, the freed voice goes to the most recent one.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     @param note The MIDI note number to remove.
+     @return The voice that was freed, or -1 if no voice was freed. When the voice went to a waiting note, tVoiceAllocator_getLastVoiceToChange() returns it.
+     
+     @fn int     tVoiceAllocator_getVoice          (tVoiceAllocator* const, int note)
+     @brief Get the voice playing a note.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     @return The voice or -1 if the note isn't sounding.
+     
+     @fn int     tVoiceAllocator_getKey            (tVoiceAllocator* const, int voice)
+     @brief Get the MIDI note number of a voice.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     @return The MIDI note number or -1 if the voice is free.
+     
+     @fn int     tVoiceAllocator_getVelocity       (tVoiceAllocator* const, int voice)
+     @brief Get the MIDI velocity of a voice.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     @return The velocity of the note the voice is playing, or 0 if the voice is free.
+     
+     @fn int     tVoiceAllocator_isOn              (tVoiceAllocator* const, int voice)
+     @brief Get whether a voice is playing a note.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     
+     @fn int     tVoiceAllocator_getLastVoiceToChange (tVoiceAllocator* const)
+     @brief Get the voice changed by the last note on or note off.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     
+     @fn int     tVoiceAllocator_getNumActiveVoices (tVoiceAllocator* const)
+     @brief Get the number of voices playing notes.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     
+     @fn int     tVoiceAllocator_getNumHeldNotes   (tVoiceAllocator* const)
+     @brief Get the number of notes held, including stolen notes waiting for a voice.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     
+     @fn void    tVoiceAllocator_setNumVoices      (tVoiceAllocator* const, int numVoices)
+     @brief Set the number of voices new notes can take. Notes already on higher voices keep them until released or stolen.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     @param numVoices The number of voices, up to the maximum given on initialization.
+     
+     @fn int     tVoiceAllocator_getNumVoices      (tVoiceAllocator* const)
+     @brief Get the number of voices new notes can take.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     
+     @fn void    tVoiceAllocator_clear             (tVoiceAllocator* const)
+     @brief Release all notes and voices.
+     @param allocator A pointer to the relevant tVoiceAllocator.
+     
+     @} */
+    
+    typedef struct _tVoiceAllocator
+    {
+        tMempool mempool;
+        
+        int numVoices;
+        int maxNumVoices;
+        int numActiveVoices;
+        int lastVoiceToChange;
+        
+        int* voiceNote;
+        int* voiceVel;
+        uint32_t* freeVoices; // one bit per voice, set when free
+        int numWords;
+        
+        int noteVoice[128];
+        uint8_t noteVel[128];
+        uint8_t noteHeld[128];
+        
+        // held notes from oldest to newest; the notes before firstVoiced are stolen and waiting
+        int notePrev[128];
+        int noteNext[128];
+        int oldest, newest;
+        int firstVoiced;
+        int numHeld;
+    } _tVoiceAllocator;
+    
+    typedef _tVoiceAllocator* tVoiceAllocator;
+    
+    void    tVoiceAllocator_init              (tVoiceAllocator* const, int maxNumVoices, LEAF* const leaf);
+    void    tVoiceAllocator_initToPool        (tVoiceAllocator* const, int maxNumVoices, tMempool* const);
+    void    tVoiceAllocator_free              (tVoiceAllocator* const);
+    
+    int     tVoiceAllocator_noteOn            (tVoiceAllocator* const, int note, uint8_t vel);
+    int     tVoiceAllocator_noteOff           (tVoiceAllocator* const, int note);
+    int     tVoiceAllocator_getVoice          (tVoiceAllocator* const, int note);
+    int     tVoiceAllocator_getKey            (tVoiceAllocator* const, int voice);
+    int     tVoiceAllocator_getVelocity       (tVoiceAllocator* const, int voice);
+    int     tVoiceAllocator_isOn              (tVoiceAllocator* const, int voice);
+    int     tVoiceAllocator_getLastVoiceToChange (tVoiceAllocator* const);
+    int     tVoiceAllocator_getNumActiveVoices (tVoiceAllocator* const);
+    int     tVoiceAllocator_getNumHeldNotes   (tVoiceAllocator* const);
+    void    tVoiceAllocator_setNumVoices      (tVoiceAllocator* const, int numVoices);
+    int     tVoiceAllocator_getNumVoices      (tVoiceAllocator* const);
+    void    tVoiceAllocator_clear             (tVoiceAllocator* const);
+    
+    //==============================================================================
+    
+    /*!
+     @defgroup tmidischeduler tMidiScheduler
+     @ingroup midi
+     @brief Sample-accurate event queue that splits an audio block at timestamped MIDI and parameter events.
+     @{
+     
+     Events are added with a sample offset into the next block. tMidiScheduler_processBlock() renders the block in pieces between event offsets, and at each offset dispatches the events there to the attached tPoly and tSimplePoly and to the registered callbacks. Events at or past the end of the block are kept for the next one.
+     
+     @fn void    tMidiScheduler_init                (tMidiScheduler* const, int maxNumEvents, LEAF* const leaf)
+     @brief Initialize a tMidiScheduler to the default mempool of a LEAF instance.
+     @param scheduler A pointer to the tMidiScheduler to initialize.
+     @param maxNumEvents The maximum number of events that can be queued at once.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tMidiScheduler_initToPool          (tMidiScheduler* const, int maxNumEvents, tMempool* const)
+     @brief Initialize a tMidiScheduler to a specified mempool.
+     @param scheduler A pointer to the tMidiScheduler to initialize.
+     @param maxNumEvents The maximum number of events that can be queued at once.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tMidiScheduler_free                (tMidiScheduler* const)
+     @brief Free a tMidiScheduler from its mempool.
+     @param scheduler A pointer to the tMidiScheduler to free.
+     
+     @fn int     tMidiScheduler_addEvent            (tMidiScheduler* const, tMidiEvent event)
+     @brief Queue an event. Events with the same offset are dispatched in the order they were added.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param event The event to queue. Negative offsets are treated as 0.
+     @return 1 if the event was queued, 0 if the queue was full.
+     
+     @fn int     tMidiScheduler_noteOn              (tMidiScheduler* const, int offset, int channel, int note, int velocity)
+     @brief Queue a note on. A velocity of 0 is dispatched as a note off.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param offset The sample offset into the next block.
+     @return 1 if the event was queued, 0 if the queue was full.
+     
+     @fn int     tMidiScheduler_noteOff             (tMidiScheduler* const, int offset, int channel, int note)
+     @brief Queue a note off.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param offset The sample offset into the next block.
+     @return 1 if the event was queued, 0 if the queue was full.
+     
+     @fn int     tMidiScheduler_controlChange       (tMidiScheduler* const, int offset, int channel, int control, int value)
+     @brief Queue a control change.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param offset The sample offset into the next block.
+     @return 1 if the event was queued, 0 if the queue was full.
+     
+     @fn int     tMidiScheduler_pitchBend           (tMidiScheduler* const, int offset, int channel, float pitchBend)
+     @brief Queue a pitch bend. An attached tPoly gets it through tPoly_setPitchBend().
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param offset The sample offset into the next block.
+     @param pitchBend The pitch bend, in the units used by tPoly_setPitchBend().
+     @return 1 if the event was queued, 0 if the queue was full.
+     
+     @fn int     tMidiScheduler_parameter           (tMidiScheduler* const, int offset, int id, float value)
+     @brief Queue a parameter change. Parameter events only go to the registered callbacks.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param offset The sample offset into the next block.
+     @param id A user-defined parameter id.
+     @param value The new parameter value.
+     @return 1 if the event was queued, 0 if the queue was full.
+     
+     @fn void    tMidiScheduler_setPoly             (tMidiScheduler* const, tPoly* const poly)
+     @brief Attach a tPoly to receive note and pitch bend events, or NULL to detach.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     
+     @fn void    tMidiScheduler_setSimplePoly       (tMidiScheduler* const, tSimplePoly* const poly)
+     @brief Attach a tSimplePoly to receive note events, or NULL to detach.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     
+     @fn int     tMidiScheduler_addCallback         (tMidiScheduler* const, void (*callback)(void* userData, tMidiEvent* event, int voice), void* userData)
+     @brief Register a callback to receive every dispatched event, after the attached poly handlers. The voice is the one the tPoly (or, without one, the tSimplePoly) assigned to or released from the note, or -1.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @return 1 if the callback was registered, 0 if MIDI_SCHEDULER_MAX_CALLBACKS are already registered.
+     
+     @fn void    tMidiScheduler_processBlock        (tMidiScheduler* const, int numSamples, void (*render)(void* userData, int offset, int numSamples), void* userData)
+     @brief Render a block, split at the offsets of the queued events. render is called for each run of samples between events (never with zero samples) and the events at each offset are dispatched before the run that starts there.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     @param numSamples The number of samples in the block.
+     @param render The function that renders numSamples samples starting at offset in the block. May be NULL to only dispatch events.
+     @param userData Passed to render.
+     
+     @fn void    tMidiScheduler_clear               (tMidiScheduler* const)
+     @brief Drop all queued events.
+     @param scheduler A pointer to the relevant tMidiScheduler.
+     
+     @} */
+    
+#define MIDI_SCHEDULER_MAX_CALLBACKS 8
+    
+    typedef enum MidiEventType
+    {
+        MidiNoteOff = 0,
+        MidiNoteOn,
+        MidiControlChange,
+        MidiPitchBend,
+        MidiParameter,
+        MidiEventTypeNil
+    } MidiEventType;
+    
+    typedef struct tMidiEvent
+    {
+        int offset;
+        MidiEventType type;
+        int channel;
+        int data1; // note, control number or parameter id
+        int data2; // velocity or control value
+        float value; // pitch bend or parameter value
+    } tMidiEvent;
+    
+    typedef struct _tMidiScheduler
+    {
+        tMempool mempool;
+        
+        tMidiEvent* events;
+        int numEvents;
+        int maxNumEvents;
+        
+        tPoly* poly;
+        tSimplePoly* simplePoly;
+        
+        void (*callbacks[MIDI_SCHEDULER_MAX_CALLBACKS])(void* userData, tMidiEvent* event, int voice);
+        void* callbackData[MIDI_SCHEDULER_MAX_CALLBACKS];
+        int numCallbacks;
+    } _tMidiScheduler;
+    
+    typedef _tMidiScheduler* tMidiScheduler;
+    
+    void    tMidiScheduler_init                (tMidiScheduler* const, int maxNumEvents, LEAF* const leaf);
+    void    tMidiScheduler_initToPool          (tMidiScheduler* const, int maxNumEvents, tMempool* const);
+    void    tMidiScheduler_free                (tMidiScheduler* const);
+    
+    int     tMidiScheduler_addEvent            (tMidiScheduler* const, tMidiEvent event);
+    int     tMidiScheduler_noteOn              (tMidiScheduler* const, int offset, int channel, int note, int velocity);
+    int     tMidiScheduler_noteOff             (tMidiScheduler* const, int offset, int channel, int note);
+    int     tMidiScheduler_controlChange       (tMidiScheduler* const, int offset, int channel, int control, int value);
+    int     tMidiScheduler_pitchBend           (tMidiScheduler* const, int offset, int channel, float pitchBend);
+    int     tMidiScheduler_parameter           (tMidiScheduler* const, int offset, int id, float value);
+    void    tMidiScheduler_setPoly             (tMidiScheduler* const, tPoly* const poly);
+    void    tMidiScheduler_setSimplePoly       (tMidiScheduler* const, tSimplePoly* const poly);
+    int     tMidiScheduler_addCallback         (tMidiScheduler* const, void (*callback)(void* userData, tMidiEvent* event, int voice), void* userData);
+    void    tMidiScheduler_processBlock        (tMidiScheduler* const, int numSamples, void (*render)(void* userData, int offset, int numSamples), void* userData);
+    void    tMidiScheduler_clear               (tMidiScheduler* const);
+    
+    //==============================================================================
+    
+    /*!
+     @defgroup tmpepoly tMPEPoly
+     @ingroup midi
+     @brief MPE zone manager that maps member channels to voices and smooths per-voice pitch bend, pressure and slide.
+     @{
+     
+     Each note takes a voice and brings its MIDI channel with it. Pitch bend, channel pressure and CC 74 (slide) on that channel then go to the voice only, and a zone's master channel bend applies to every voice in the zone. The three expression values of every voice are one-pole smoothed in structure-of-arrays form and advanced with a single tMPEPoly_tickBlock() per buffer instead of a smoother tick per voice per sample. Channels are numbered 0 to 15. Only MPE notes are tracked, with one note per channel; a new note on a channel that already has one takes its voice over.
+     
+     @fn void    tMPEPoly_init                (tMPEPoly* const, int numVoices, LEAF* const leaf)
+     @brief Initialize a tMPEPoly to the default mempool of a LEAF instance. The default layout is a lower zone with 15 member channels.
+     @param mpe A pointer to the tMPEPoly to initialize.
+     @param numVoices The number of voices.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tMPEPoly_initToPool          (tMPEPoly* const, int numVoices, tMempool* const)
+     @brief Initialize a tMPEPoly to a specified mempool.
+     @param mpe A pointer to the tMPEPoly to initialize.
+     @param numVoices The number of voices.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tMPEPoly_free                (tMPEPoly* const)
+     @brief Free a tMPEPoly from its mempool.
+     @param mpe A pointer to the tMPEPoly to free.
+     
+     @fn void    tMPEPoly_setZones            (tMPEPoly* const, int numLowerMembers, int numUpperMembers)
+     @brief Set the zone layout, as an MPE configuration message would. The lower zone's master is channel 0 with members from channel 1 up, the upper zone's master is channel 15 with members from channel 14 down.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @param numLowerMembers The number of member channels in the lower zone, 0 to 15.
+     @param numUpperMembers The number of member channels in the upper zone, 0 to 15.
+     
+     @fn void    tMPEPoly_setPitchBendRange   (tMPEPoly* const, float memberRange, float masterRange)
+     @brief Set the pitch bend ranges in semitones. The MPE defaults are 48 for member channels and 2 for master channels.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn void    tMPEPoly_setSmoothTime       (tMPEPoly* const, float time)
+     @brief Set the time constant of the expression smoothing.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @param time The time constant in milliseconds. 0 turns smoothing off.
+     
+     @fn int     tMPEPoly_noteOn              (tMPEPoly* const, int channel, int note, int velocity)
+     @brief Start a note. The voice starts from the channel's current expression values without smoothing.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @return The voice that will play the note. When all voices are busy the one started longest ago is taken.
+     
+     @fn int     tMPEPoly_noteOff             (tMPEPoly* const, int channel, int note)
+     @brief End a note. The voice keeps following the channel's expression during its release until it is reused.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @return The voice that played the note, or -1 if the note wasn't playing.
+     
+     @fn void    tMPEPoly_pitchBend           (tMPEPoly* const, int channel, int value)
+     @brief Set a channel's pitch bend.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @param value The 14-bit pitch bend value, 8192 at center.
+     
+     @fn void    tMPEPoly_pressure            (tMPEPoly* const, int channel, int value)
+     @brief Set a channel's pressure from a channel aftertouch message.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @param value The pressure, 0 to 127.
+     
+     @fn void    tMPEPoly_controlChange       (tMPEPoly* const, int channel, int control, int value)
+     @brief Handle a control change. CC 74 sets the channel's slide; other controls are ignored.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn void    tMPEPoly_tickBlock           (tMPEPoly* const, int numSamples)
+     @brief Advance the smoothing of every voice by a block.
+     @param mpe A pointer to the relevant tMPEPoly.
+     @param numSamples The number of samples in the block.
+     
+     @fn float   tMPEPoly_getPitch            (tMPEPoly* const, int voice)
+     @brief Get a voice's pitch as a fractional MIDI note number, including member and master bend.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn float   tMPEPoly_getPressure         (tMPEPoly* const, int voice)
+     @brief Get a voice's smoothed pressure from 0 to 1.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn float   tMPEPoly_getSlide            (tMPEPoly* const, int voice)
+     @brief Get a voice's smoothed slide from 0 to 1.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn int     tMPEPoly_getKey              (tMPEPoly* const, int voice)
+     @brief Get the MIDI note number of a voice's current or last note, or -1 if it has never played.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn int     tMPEPoly_getVelocity         (tMPEPoly* const, int voice)
+     @brief Get the note on velocity of a voice's note.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn int     tMPEPoly_getChannel          (tMPEPoly* const, int voice)
+     @brief Get the channel a voice follows, or -1.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn int     tMPEPoly_isOn                (tMPEPoly* const, int voice)
+     @brief Get whether a voice's note is held.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @fn void    tMPEPoly_setSampleRate       (tMPEPoly* const, float sr)
+     @brief Set the sample rate used for the smoothing time.
+     @param mpe A pointer to the relevant tMPEPoly.
+     
+     @} */
+    
+#define MPE_NUM_CHANNELS 16
+    
+    typedef struct _tMPEPoly
+    {
+        tMempool mempool;
+        
+        int numVoices;
+        
+        // per-voice state, one allocation each for floats and ints
+        float* params;
+        float* bend;
+        float* bendDest;
+        float* pressure;
+        float* pressureDest;
+        float* slide;
+        float* slideDest;
+        int* voiceInfo;
+        int* note;
+        int* velocity;
+        int* channel;
+        int* isOn;
+        int* age;
+        int ageCounter;
+        
+        int channelVoice[MPE_NUM_CHANNELS];
+        float channelBend[MPE_NUM_CHANNELS]; // in semitones, master channels included
+        float channelPressure[MPE_NUM_CHANNELS];
+        float channelSlide[MPE_NUM_CHANNELS];
+        
+        int numLowerMembers, numUpperMembers;
+        float memberBendRange, masterBendRange;
+        
+        float smoothTime;
+        float oneMinusFactor; // per-sample decay of the distance to the destination
+        int lastBlockSize;
+        float blockCoef;
+        
+        float sampleRate;
+    } _tMPEPoly;
+    
+    typedef _tMPEPoly* tMPEPoly;
+    
+    void    tMPEPoly_init                (tMPEPoly* const, int numVoices, LEAF* const leaf);
+    void    tMPEPoly_initToPool          (tMPEPoly* const, int numVoices, tMempool* const);
+    void    tMPEPoly_free                (tMPEPoly* const);
+    
+    void    tMPEPoly_setZones            (tMPEPoly* const, int numLowerMembers, int numUpperMembers);
+    void    tMPEPoly_setPitchBendRange   (tMPEPoly* const, float memberRange, float masterRange);
+    void    tMPEPoly_setSmoothTime       (tMPEPoly* const, float time);
+    int     tMPEPoly_noteOn              (tMPEPoly* const, int channel, int note, int velocity);
+    int     tMPEPoly_noteOff             (tMPEPoly* const, int channel, int note);
+    void    tMPEPoly_pitchBend           (tMPEPoly* const, int channel, int value);
+    void    tMPEPoly_pressure            (tMPEPoly* const, int channel, int value);
+    void    tMPEPoly_controlChange       (tMPEPoly* const, int channel, int control, int value);
+    void    tMPEPoly_tickBlock           (tMPEPoly* const, int numSamples);
+    float   tMPEPoly_getPitch            (tMPEPoly* const, int voice);
+    float   tMPEPoly_getPressure         (tMPEPoly* const, int voice);
+    float   tMPEPoly_getSlide            (tMPEPoly* const, int voice);
+    int     tMPEPoly_getKey              (tMPEPoly* const, int voice);
+    int     tMPEPoly_getVelocity         (tMPEPoly* const, int voice);
+    int     tMPEPoly_getChannel          (tMPEPoly* const, int voice);
+    int     tMPEPoly_isOn                (tMPEPoly* const, int voice);
+    void    tMPEPoly_setSampleRate       (tMPEPoly* const, float sr);
 
     //==============================================================================
     
@@ -1340,6 +1340,17 @@ extern "C" {
      @brief
      @param osc A pointer to the relevant tIntPhasor.
      ￼￼￼
+     @fn void    tIntPhasor_tickBlock     (tIntPhasor* const osc, float* output, int numSamples)
+     @brief Render a block at control rate. The phasor advances once every control period and the samples in between are linearly interpolated, with the reset stepped on the sample where the phase wraps. Periods are shortened so the phase wraps at most once in each.
+     @param osc A pointer to the relevant tIntPhasor.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tIntPhasor_setControlRate (tIntPhasor* const osc, int controlRate)
+     @brief Set the control period of tIntPhasor_tickBlock in samples. 0 follows the LEAF control rate.
+     @param osc A pointer to the relevant tIntPhasor.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tIntPhasor
@@ -1352,6 +1363,11 @@ extern "C" {
         int32_t mask;
         uint8_t phaseDidReset;
         float invSampleRateTimesTwoTo32;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
+        int controlStepAt[1];
+        float controlStep[1];
     } _tIntPhasor;
     
     typedef _tIntPhasor* tIntPhasor;
@@ -1361,10 +1377,12 @@ extern "C" {
     void    tIntPhasor_free        (tIntPhasor* const osc);
     
     float   tIntPhasor_tick        (tIntPhasor* const osc);
+    void    tIntPhasor_tickBlock     (tIntPhasor* const osc, float* output, int numSamples);
     void    tIntPhasor_setFreq     (tIntPhasor* const osc, float freq);
     void    tIntPhasor_setSampleRate (tIntPhasor* const osc, float sr);
     
     void    tIntPhasor_setPhase(tIntPhasor* const cy, float phase);
+    void    tIntPhasor_setControlRate (tIntPhasor* const osc, int controlRate);
     
          //==============================================================================
     
@@ -1396,6 +1414,17 @@ extern "C" {
      @brief
      @param osc A pointer to the relevant tSquareLFO.
      ￼￼￼
+     @fn void    tSquareLFO_tickBlock     (tSquareLFO* const osc, float* output, int numSamples)
+     @brief Render a block at control rate. The LFO advances once every control period and the samples in between are linearly interpolated, with the edges stepped on the samples where they fall.
+     @param osc A pointer to the relevant tSquareLFO.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tSquareLFO_setControlRate (tSquareLFO* const osc, int controlRate)
+     @brief Set the control period of tSquareLFO_tickBlock in samples. 0 follows the LEAF control rate.
+     @param osc A pointer to the relevant tSquareLFO.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tSquareLFO
@@ -1405,6 +1434,11 @@ extern "C" {
         float pulsewidth;
         tIntPhasor phasor;
         tIntPhasor invPhasor;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
+        int controlStepAt[2];
+        float controlStep[2];
     } _tSquareLFO;
     
     typedef _tSquareLFO* tSquareLFO;
@@ -1414,10 +1448,12 @@ extern "C" {
     void    tSquareLFO_free        (tSquareLFO* const osc);
     
     float   tSquareLFO_tick        (tSquareLFO* const osc);
+    void    tSquareLFO_tickBlock     (tSquareLFO* const osc, float* output, int numSamples);
     void    tSquareLFO_setFreq     (tSquareLFO* const osc, float freq);
     void    tSquareLFO_setSampleRate (tSquareLFO* const osc, float sr);
     void    tSquareLFO_setPulseWidth (tSquareLFO* const cy, float pw);
     void    tSquareLFO_setPhase (tSquareLFO* const cy, float phase);
+    void    tSquareLFO_setControlRate (tSquareLFO* const osc, int controlRate);
 
     typedef struct _tSawSquareLFO
     {
@@ -1425,6 +1461,10 @@ extern "C" {
         float shape;
         tIntPhasor saw;
         tSquareLFO square;
+        int controlRate, controlCount;
+        float controlValue, controlInc;
+        int controlStepAt[3];
+        float controlStep[3];
     } _tSawSquareLFO;
 
     typedef _tSawSquareLFO* tSawSquareLFO;
@@ -1434,10 +1474,12 @@ extern "C" {
     void    tSawSquareLFO_free        (tSawSquareLFO* const osc);
     
     float   tSawSquareLFO_tick        (tSawSquareLFO* const osc);
+    void    tSawSquareLFO_tickBlock     (tSawSquareLFO* const osc, float* output, int numSamples);
     void    tSawSquareLFO_setFreq     (tSawSquareLFO* const osc, float freq);
     void    tSawSquareLFO_setSampleRate (tSawSquareLFO* const osc, float sr);
     void    tSawSquareLFO_setPhase (tSawSquareLFO* const cy, float phase);
     void    tSawSquareLFO_setShape (tSawSquareLFO* const cy, float shape);
+    void    tSawSquareLFO_setControlRate (tSawSquareLFO* const osc, int controlRate);
 
         //==============================================================================
  /*!
@@ -1468,6 +1510,17 @@ extern "C" {
      @brief
      @param osc A pointer to the relevant tTriLFO.
      ￼￼￼
+     @fn void    tTriLFO_tickBlock     (tTriLFO* const osc, float* output, int numSamples)
+     @brief Render a block at control rate. The LFO advances once every control period and the samples in between are linearly interpolated.
+     @param osc A pointer to the relevant tTriLFO.
+     @param output The buffer to write numSamples samples to.
+     @param numSamples The number of samples to render.
+     
+     @fn void    tTriLFO_setControlRate (tTriLFO* const osc, int controlRate)
+     @brief Set the control period of tTriLFO_tickBlock in samples. 0 follows the LEAF control rate.
+     @param osc A pointer to the relevant tTriLFO.
+     @param controlRate The number of samples between updates, or 0 to use LEAF_setControlRate().
+     
      @} */
     
     typedef struct _tTriLFO
@@ -1479,6 +1532,9 @@ extern "C" {
         float freq;
         float invSampleRate;
         float invSampleRateTimesTwoTo32;
+        
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tTriLFO;
     
     typedef _tTriLFO* tTriLFO;
@@ -1488,10 +1544,12 @@ extern "C" {
     void    tTriLFO_free        (tTriLFO* const osc);
     
     float   tTriLFO_tick        (tTriLFO* const osc);
+    void    tTriLFO_tickBlock     (tTriLFO* const osc, float* output, int numSamples);
     void    tTriLFO_setFreq     (tTriLFO* const osc, float freq);
     void    tTriLFO_setSampleRate (tTriLFO* const osc, float sr);
     
     void    tTriLFO_setPhase(tTriLFO* const cy, float phase);
+    void    tTriLFO_setControlRate (tTriLFO* const osc, int controlRate);
 
     typedef struct _tSineTriLFO
     {
@@ -1499,6 +1557,8 @@ extern "C" {
         float shape;
         tTriLFO tri;
         tCycle sine;
+        int controlRate, controlCount;
+        float controlValue, controlInc;
     } _tSineTriLFO;
 
     typedef _tSineTriLFO* tSineTriLFO;
@@ -1508,10 +1568,12 @@ extern "C" {
     void    tSineTriLFO_free        (tSineTriLFO* const osc);
     
     float   tSineTriLFO_tick        (tSineTriLFO* const osc);
+    void    tSineTriLFO_tickBlock     (tSineTriLFO* const osc, float* output, int numSamples);
     void    tSineTriLFO_setFreq     (tSineTriLFO* const osc, float freq);
     void    tSineTriLFO_setSampleRate (tSineTriLFO* const osc, float sr);
     void    tSineTriLFO_setPhase (tSineTriLFO* const cy, float phase);
     void    tSineTriLFO_setShape (tSineTriLFO* const cy, float shape); 
+    void    tSineTriLFO_setControlRate (tSineTriLFO* const osc, int controlRate);
 #ifdef __cplusplus
 }
 #endif
@@ -60,6 +60,14 @@ extern "C" {
      @brief
      @param string A pointer to the relevant tPluck.
      
+     @fn float   tPluck_tickEfficient (tPluck* const)
+     @brief Tick the string without applying pending parameter changes. Call tPluck_updateDelays() at a control rate to apply them.
+     @param string A pointer to the relevant tPluck.
+     
+     @fn void    tPluck_updateDelays  (tPluck* const)
+     @brief Apply pending frequency changes to the delay lines and filters. The setters only store their values, tick applies them before processing, and tickEfficient leaves them for this call so the recomputation can run at a control rate.
+     @param string A pointer to the relevant tPluck.
+     
      @fn void    tPluck_pluck         (tPluck* const, float amplitude)
      @brief Pluck the string.
      @param string A pointer to the relevant tPluck.
@@ -99,6 +107,7 @@ extern "C" {
         float lastOut;
         float loopGain;
         float lastFreq;
+        uint8_t paramsChanged;
         
         float sampleRate;
     } _tPluck;
@@ -110,6 +119,8 @@ extern "C" {
     void    tPluck_free          (tPluck* const);
     
     float   tPluck_tick          (tPluck* const);
+    float   tPluck_tickEfficient (tPluck* const);
+    void    tPluck_updateDelays  (tPluck* const);
     void    tPluck_pluck         (tPluck* const, float amplitude);
     void    tPluck_noteOn        (tPluck* const, float frequency, float amplitude );
     void    tPluck_noteOff       (tPluck* const, float amplitude );
@@ -144,6 +155,14 @@ extern "C" {
      @brief
      @param string A pointer to the relevant tKarplusStrong.
      
+     @fn float   tKarplusStrong_tickEfficient      (tKarplusStrong* const)
+     @brief Tick the string without applying pending parameter changes. Call tKarplusStrong_updateDelays() at a control rate to apply them.
+     @param string A pointer to the relevant tKarplusStrong.
+     
+     @fn void    tKarplusStrong_updateDelays       (tKarplusStrong* const)
+     @brief Apply pending frequency, stretch and pickup position changes to the delay lines and filters. The setters only store their values, tick applies them before processing, and tickEfficient leaves them for this call so the recomputation can run at a control rate.
+     @param string A pointer to the relevant tKarplusStrong.
+     
      @fn void    tKarplusStrong_pluck              (tKarplusStrong* const, float amplitude)
      @brief Pluck the string.
      @param string A pointer to the relevant tKarplusStrong.
@@ -209,6 +228,7 @@ extern "C" {
         float stretching;
         float pluckAmplitude;
         float pickupPosition;
+        uint8_t paramsChanged;
         
         float lastOut;
         
@@ -222,6 +242,8 @@ extern "C" {
     void    tKarplusStrong_free               (tKarplusStrong* const);
     
     float   tKarplusStrong_tick               (tKarplusStrong* const);
+    float   tKarplusStrong_tickEfficient      (tKarplusStrong* const);
+    void    tKarplusStrong_updateDelays       (tKarplusStrong* const);
     void    tKarplusStrong_pluck              (tKarplusStrong* const, float amplitude);
     void    tKarplusStrong_noteOn             (tKarplusStrong* const, float frequency, float amplitude );
     void    tKarplusStrong_noteOff            (tKarplusStrong* const, float amplitude );
@@ -258,6 +280,14 @@ extern "C" {
      @brief
      @param string A pointer to the relevant tSimpleLivingString.
      
+     @fn float   tSimpleLivingString_tickEfficient       (tSimpleLivingString* const, float input)
+     @brief Tick the string without smoothing parameters or updating its delay lengths. Call tSimpleLivingString_updateDelays() at a control rate to apply parameter changes.
+     @param string A pointer to the relevant tSimpleLivingString.
+     
+     @fn void    tSimpleLivingString_updateDelays        (tSimpleLivingString* const)
+     @brief Set the delay lengths from the current parameter targets, skipping the smoothing. tick does this every sample; call it at a control rate when using tickEfficient.
+     @param string A pointer to the relevant tSimpleLivingString.
+     
      @fn float   tSimpleLivingString_sample              (tSimpleLivingString* const)
      @brief
      @param string A pointer to the relevant tSimpleLivingString.
@@ -324,6 +354,8 @@ extern "C" {
     void    tSimpleLivingString_free                (tSimpleLivingString* const);
     
     float   tSimpleLivingString_tick                (tSimpleLivingString* const, float input);
+    float   tSimpleLivingString_tickEfficient       (tSimpleLivingString* const, float input);
+    void    tSimpleLivingString_updateDelays        (tSimpleLivingString* const);
     float   tSimpleLivingString_sample              (tSimpleLivingString* const);
     void    tSimpleLivingString_setFreq             (tSimpleLivingString* const, float freq);
     void    tSimpleLivingString_setWaveLength       (tSimpleLivingString* const, float waveLength); // in samples
@@ -367,6 +399,8 @@ extern "C" {
     void    tSimpleLivingString2_free                (tSimpleLivingString2* const);
 
     float   tSimpleLivingString2_tick                (tSimpleLivingString2* const, float input);
+    float   tSimpleLivingString2_tickEfficient       (tSimpleLivingString2* const, float input);
+    void    tSimpleLivingString2_updateDelays        (tSimpleLivingString2* const);
     float   tSimpleLivingString2_sample              (tSimpleLivingString2* const);
     void    tSimpleLivingString2_setFreq             (tSimpleLivingString2* const, float freq);
     void    tSimpleLivingString2_setWaveLength       (tSimpleLivingString2* const, float waveLength); // in samples
@@ -404,6 +438,14 @@ extern "C" {
      @brief
      @param string A pointer to the relevant tLivingString.
      
+     @fn float   tLivingString_tickEfficient         (tLivingString* const, float input)
+     @brief Tick the string without smoothing parameters or updating its delay lengths. Call tLivingString_updateDelays() at a control rate to apply parameter changes.
+     @param string A pointer to the relevant tLivingString.
+     
+     @fn void    tLivingString_updateDelays          (tLivingString* const)
+     @brief Set the delay lengths from the current parameter targets, skipping the smoothing. tick does this every sample; call it at a control rate when using tickEfficient.
+     @param string A pointer to the relevant tLivingString.
+     
      @fn float   tLivingString_sample                (tLivingString* const)
      @brief
      @param string A pointer to the relevant tLivingString.
@@ -479,6 +521,8 @@ extern "C" {
     void    tLivingString_free                  (tLivingString* const);
     
     float   tLivingString_tick                  (tLivingString* const, float input);
+    float   tLivingString_tickEfficient         (tLivingString* const, float input);
+    void    tLivingString_updateDelays          (tLivingString* const);
     float   tLivingString_sample                (tLivingString* const);
     void    tLivingString_setFreq               (tLivingString* const, float freq);
     void    tLivingString_setWaveLength         (tLivingString* const, float waveLength); // in samples
@@ -519,6 +563,14 @@ extern "C" {
      @brief
      @param string A pointer to the relevant tLivingString2.
      
+     @fn float   tLivingString2_tickEfficient         (tLivingString2* const, float input)
+     @brief A cheaper tick that reads the parameter targets directly, injects the input without interpolation and always takes the output at the bridge. Call tLivingString2_updateDelays() at a control rate to apply parameter changes.
+     @param string A pointer to the relevant tLivingString2.
+     
+     @fn void    tLivingString2_updateDelays          (tLivingString2* const)
+     @brief Set the delay lengths from the current parameter targets, skipping the smoothing. tick does this every sample; call it at a control rate when using tickEfficient.
+     @param string A pointer to the relevant tLivingString2.
+     
      @fn float   tLivingString2_sample                (tLivingString2* const)
      @brief
      @param string A pointer to the relevant tLivingString2.
@@ -647,6 +699,14 @@ extern "C" {
      @brief
      @param string A pointer to the relevant tComplexLivingString.
      
+     @fn float   tComplexLivingString_tickEfficient         (tComplexLivingString* const, float input)
+     @brief Tick the string without smoothing parameters or updating its delay lengths. Call tComplexLivingString_updateDelays() at a control rate to apply parameter changes.
+     @param string A pointer to the relevant tComplexLivingString.
+     
+     @fn void    tComplexLivingString_updateDelays          (tComplexLivingString* const)
+     @brief Set the delay lengths from the current parameter targets, skipping the smoothing. tick does this every sample; call it at a control rate when using tickEfficient.
+     @param string A pointer to the relevant tComplexLivingString.
+     
      @fn float   tComplexLivingString_sample                (tComplexLivingString* const)
      @brief
      @param string A pointer to the relevant tComplexLivingString.
@@ -730,6 +790,8 @@ extern "C" {
     void    tComplexLivingString_free                  (tComplexLivingString* const);
     
     float   tComplexLivingString_tick                  (tComplexLivingString* const, float input);
+    float   tComplexLivingString_tickEfficient         (tComplexLivingString* const, float input);
+    void    tComplexLivingString_updateDelays          (tComplexLivingString* const);
     float   tComplexLivingString_sample                (tComplexLivingString* const);
     void    tComplexLivingString_setFreq               (tComplexLivingString* const, float freq);
     void    tComplexLivingString_setWaveLength         (tComplexLivingString* const, float waveLength); // in samples
@@ -747,6 +809,329 @@ extern "C" {
     // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
     
     
+    /*!
+     @defgroup tlivingstringbank tLivingStringBank
+     @ingroup physical
+     @brief A bank of tLivingString2 strings with their waveguide, filter and leveler state stored in arrays, so all strings are ticked together in straight loops instead of through separate objects.
+     @{
+     
+     @fn void    tLivingStringBank_init                  (tLivingStringBank* const, int numStrings, float freq, float pickPos, float prepPos, float pickupPos, float prepIndex, float brightness, float decay, float targetLev, float levSmoothFactor, float levStrength, int levMode, LEAF* const leaf)
+     @brief Initialize a tLivingStringBank to the default mempool of a LEAF instance. Every string starts with the same settings, which take the same values as tLivingString2_init.
+     @param bank A pointer to the tLivingStringBank to initialize.
+     @param numStrings The number of strings in the bank.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tLivingStringBank_initToPool            (tLivingStringBank* const, int numStrings, float freq, float pickPos, float prepPos, float pickupPos, float prepIndex, float brightness, float decay, float targetLev, float levSmoothFactor, float levStrength, int levMode, tMempool* const)
+     @brief Initialize a tLivingStringBank to a specified mempool.
+     @param bank A pointer to the tLivingStringBank to initialize.
+     @param numStrings The number of strings in the bank.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tLivingStringBank_free                  (tLivingStringBank* const)
+     @brief Free a tLivingStringBank from its mempool.
+     @param bank A pointer to the tLivingStringBank to free.
+     
+     @fn void    tLivingStringBank_tick                  (tLivingStringBank* const, float* input, float* output)
+     @brief Tick every string once. Each string produces the same output as a tLivingString2 with the same settings.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param input An array of numStrings input samples.
+     @param output An array of numStrings output samples.
+     
+     @fn float   tLivingStringBank_tickMix               (tLivingStringBank* const, float* input)
+     @brief Tick every string once and return the sum of their outputs.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param input An array of numStrings input samples.
+     @return The summed output of the strings.
+     
+     @fn void    tLivingStringBank_tickBlock             (tLivingStringBank* const, float** input, float** output, int numSamples)
+     @brief Process a block for every string.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param input An array of numStrings input blocks. A NULL block is treated as silence.
+     @param output An array of numStrings output blocks. A NULL block is skipped.
+     @param numSamples The number of samples to process.
+     
+     @fn float   tLivingStringBank_sample                (tLivingStringBank* const, int string)
+     @brief Get the last output of a string.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1.
+     @return The string's last output, or 0 for an index out of range.
+     
+     @fn void    tLivingStringBank_setFreq               (tLivingStringBank* const, int string, float freq)
+     @brief Set the frequency of a string, as tLivingString2_setFreq.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setWaveLength         (tLivingStringBank* const, int string, float waveLength)
+     @brief Set the wavelength of a string in samples, as tLivingString2_setWaveLength.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setPickPos            (tLivingStringBank* const, int string, float pickPos)
+     @brief Set the pick position of a string from 0 to 1.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setPrepPos            (tLivingStringBank* const, int string, float prepPos)
+     @brief Set the preparation position of a string from 0 to 1.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setPickupPos          (tLivingStringBank* const, int string, float pickupPos)
+     @brief Set the pickup position of a string from 0 to 1. At 1 the output is taken at the bridge.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setPrepIndex          (tLivingStringBank* const, int string, float prepIndex)
+     @brief Set the preparation pressure of a string from 0 to 1.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setDecay              (tLivingStringBank* const, int string, float decay)
+     @brief Set the decay of a string, as tLivingString2_setDecay.
+     @param bank A pointer to the relevant tLivingStringBank.
+     @param string The index of the string, from 0 to numStrings - 1. Other indices are ignored.
+     
+     @fn void    tLivingStringBank_setBrightness         (tLivingStringBank* const, float brightness)
+     @brief Set the brightness of all strings from 0 to 1. The filter coefficients are shared by the whole bank.
+     @param bank A pointer to the relevant tLivingStringBank.
+     
+     @fn void    tLivingStringBank_setTargetLev          (tLivingStringBank* const, float targetLev)
+     @brief Set the feedback leveler target level of all strings.
+     @param bank A pointer to the relevant tLivingStringBank.
+     
+     @fn void    tLivingStringBank_setLevSmoothFactor    (tLivingStringBank* const, float levSmoothFactor)
+     @brief Set the feedback leveler smoothing factor of all strings.
+     @param bank A pointer to the relevant tLivingStringBank.
+     
+     @fn void    tLivingStringBank_setLevStrength        (tLivingStringBank* const, float levStrength)
+     @brief Set the feedback leveler strength of all strings.
+     @param bank A pointer to the relevant tLivingStringBank.
+     
+     @fn void    tLivingStringBank_setLevMode            (tLivingStringBank* const, int levMode)
+     @brief Set the feedback leveler mode of all strings.
+     @param bank A pointer to the relevant tLivingStringBank.
+     
+     @} */
+    
+#define LIVINGSTRINGBANK_LINE_SIZE 4096
+    
+    typedef struct _tLivingStringBank
+    {
+        tMempool mempool;
+        
+        int numStrings;
+        
+        // four waveguide lines per string (lower forward, upper forward, upper backward, lower backward)
+        float* buff;
+        uint32_t bufferMask;
+        uint32_t* points;
+        uint32_t* inPoint;
+        uint32_t* outPointL;
+        uint32_t* outPointU;
+        
+        // per-string parameters and state, carved from one allocation
+        float* state;
+        float* wlCurr;
+        float* wlDest;
+        float* ppCurr;
+        float* ppDest;
+        float* prpCurr;
+        float* prpDest;
+        float* puCurr;
+        float* puDest;
+        float* alphaL;
+        float* alphaU;
+        float* freq;
+        float* waveLength;
+        float* prepIndex;
+        float* decay;
+        float* curr;
+        float* bridgeLast;
+        float* bridgeLast2;
+        float* nutLast;
+        float* nutLast2;
+        float* prepULast;
+        float* prepULast2;
+        float* prepLLast;
+        float* prepLLast2;
+        float* dcUIn;
+        float* dcUOut;
+        float* dcLIn;
+        float* dcLOut;
+        float* levUPower;
+        float* levLPower;
+        float* waveLF;
+        float* waveUF;
+        float* waveUB;
+        float* waveLB;
+        float* in;
+        
+        // coefficients shared by every string
+        float h0, h1;
+        float dcR;
+        float wlFactor, wlOneMinusFactor;
+        float posFactor, posOneMinusFactor;
+        float levTarget, levStrength;
+        float levFactor, levOneMinusFactor;
+        int levMode;
+        
+        float sampleRate;
+        float twoPiTimesInvSampleRate;
+    } _tLivingStringBank;
+    
+    typedef _tLivingStringBank* tLivingStringBank;
+    
+    void    tLivingStringBank_init                  (tLivingStringBank* const, int numStrings, float freq, float pickPos, float prepPos,
+                                                     float pickupPos, float prepIndex, float brightness, float decay, float targetLev,
+                                                     float levSmoothFactor, float levStrength, int levMode, LEAF* const leaf);
+    void    tLivingStringBank_initToPool            (tLivingStringBank* const, int numStrings, float freq, float pickPos, float prepPos,
+                                                     float pickupPos, float prepIndex, float brightness, float decay, float targetLev,
+                                                     float levSmoothFactor, float levStrength, int levMode, tMempool* const);
+    void    tLivingStringBank_free                  (tLivingStringBank* const);
+    
+    void    tLivingStringBank_tick                  (tLivingStringBank* const, float* input, float* output);
+    float   tLivingStringBank_tickMix               (tLivingStringBank* const, float* input);
+    void    tLivingStringBank_tickBlock             (tLivingStringBank* const, float** input, float** output, int numSamples);
+    float   tLivingStringBank_sample                (tLivingStringBank* const, int string);
+    void    tLivingStringBank_setFreq               (tLivingStringBank* const, int string, float freq);
+    void    tLivingStringBank_setWaveLength         (tLivingStringBank* const, int string, float waveLength); // in samples
+    void    tLivingStringBank_setPickPos            (tLivingStringBank* const, int string, float pickPos);
+    void    tLivingStringBank_setPrepPos            (tLivingStringBank* const, int string, float prepPos);
+    void    tLivingStringBank_setPickupPos          (tLivingStringBank* const, int string, float pickupPos);
+    void    tLivingStringBank_setPrepIndex          (tLivingStringBank* const, int string, float prepIndex);
+    void    tLivingStringBank_setDecay              (tLivingStringBank* const, int string, float decay);
+    void    tLivingStringBank_setBrightness         (tLivingStringBank* const, float brightness);
+    void    tLivingStringBank_setTargetLev          (tLivingStringBank* const, float targetLev);
+    void    tLivingStringBank_setLevSmoothFactor    (tLivingStringBank* const, float levSmoothFactor);
+    void    tLivingStringBank_setLevStrength        (tLivingStringBank* const, float levStrength);
+    void    tLivingStringBank_setLevMode            (tLivingStringBank* const, int levMode);
+    void    tLivingStringBank_setSampleRate         (tLivingStringBank* const, float sr);
+    
+    // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
+    
+    
+    /*!
+     @defgroup tmodalbank tModalBank
+     @ingroup physical
+     @brief A bank of decaying resonant modes for modal synthesis of bells, bars and plates. Each mode has a frequency ratio, a decay time and a gain, stored in arrays and processed in groups of MODALBANK_LANES.
+     @{
+     
+     @fn void    tModalBank_init                 (tModalBank* const, int maxModes, LEAF* const leaf)
+     @brief Initialize a tModalBank to the default mempool of a LEAF instance.
+     @param bank A pointer to the tModalBank to initialize.
+     @param maxModes The maximum number of modes.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tModalBank_initToPool           (tModalBank* const, int maxModes, tMempool* const)
+     @brief Initialize a tModalBank to a specified mempool.
+     @param bank A pointer to the tModalBank to initialize.
+     @param maxModes The maximum number of modes.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tModalBank_free                 (tModalBank* const)
+     @brief Free a tModalBank from its mempool.
+     @param bank A pointer to the tModalBank to free.
+     
+     @fn float   tModalBank_tick                 (tModalBank* const, float input)
+     @brief Excite every mode with an input sample and return the sum of the modes.
+     @param bank A pointer to the relevant tModalBank.
+     @param input The excitation sample.
+     @return The summed output of the modes.
+     
+     @fn void    tModalBank_tickBlock            (tModalBank* const, float* input, float* output, int numSamples)
+     @brief Process a block of excitation. Much cheaper per sample than tick.
+     @param bank A pointer to the relevant tModalBank.
+     @param input The excitation block. May be NULL to let the modes ring.
+     @param output The output block. May be the same as the input block.
+     @param numSamples The number of samples to process.
+     
+     @fn void    tModalBank_clear                (tModalBank* const)
+     @brief Silence every mode.
+     @param bank A pointer to the relevant tModalBank.
+     
+     @fn void    tModalBank_setModes             (tModalBank* const, float* ratios, float* decays, float* gains, int numModes)
+     @brief Set every mode at once, for example from an analysis table.
+     @param bank A pointer to the relevant tModalBank.
+     @param ratios The frequency of each mode as a ratio of the fundamental.
+     @param decays The T60 decay time of each mode in seconds. May be NULL to keep the current decays.
+     @param gains The gain of each mode. May be NULL to keep the current gains.
+     @param numModes The number of modes to use, up to maxModes.
+     
+     @fn void    tModalBank_setMode              (tModalBank* const, int mode, float ratio, float decay, float gain)
+     @brief Set a single mode.
+     @param bank A pointer to the relevant tModalBank.
+     @param mode The index of the mode.
+     @param ratio The frequency of the mode as a ratio of the fundamental.
+     @param decay The T60 decay time of the mode in seconds.
+     @param gain The gain of the mode.
+     
+     @fn void    tModalBank_setNumModes          (tModalBank* const, int numModes)
+     @brief Set the number of modes in use, up to maxModes.
+     @param bank A pointer to the relevant tModalBank.
+     
+     @fn void    tModalBank_setFundamental       (tModalBank* const, float freq)
+     @brief Set the fundamental frequency in Hz that the mode ratios are multiplied by. Modes above Nyquist are muted.
+     @param bank A pointer to the relevant tModalBank.
+     
+     @fn void    tModalBank_setDecayScale        (tModalBank* const, float scale)
+     @brief Scale the decay time of every mode, for damping.
+     @param bank A pointer to the relevant tModalBank.
+     
+     @fn void    tModalBank_setSampleRate        (tModalBank* const, float sr)
+     @brief Set the sample rate and recompute every mode. Modes at or above the new Nyquist frequency are muted.
+     @param bank A pointer to the relevant tModalBank.
+     @param sr The new sample rate.
+     
+     @} */
+    
+#define MODALBANK_LANES 8
+#define MODALBANK_CHUNK 64
+    
+    typedef struct _tModalBank
+    {
+        tMempool mempool;
+        
+        int maxModes;
+        int numModes;
+        
+        // per-mode parameters and state, carved from one allocation and padded to MODALBANK_LANES
+        float* modes;
+        float* ratio;
+        float* decay;
+        float* amp;
+        float* coeffRe;
+        float* coeffIm;
+        float* gain;
+        float* stateRe;
+        float* stateIm;
+        
+        float* accum;
+        
+        float fundamental;
+        float decayScale;
+        float sampleRate;
+        float invSampleRate;
+    } _tModalBank;
+    
+    typedef _tModalBank* tModalBank;
+    
+    void    tModalBank_init                 (tModalBank* const, int maxModes, LEAF* const leaf);
+    void    tModalBank_initToPool           (tModalBank* const, int maxModes, tMempool* const);
+    void    tModalBank_free                 (tModalBank* const);
+    
+    float   tModalBank_tick                 (tModalBank* const, float input);
+    void    tModalBank_tickBlock            (tModalBank* const, float* input, float* output, int numSamples);
+    void    tModalBank_clear                (tModalBank* const);
+    void    tModalBank_setModes             (tModalBank* const, float* ratios, float* decays, float* gains, int numModes);
+    void    tModalBank_setMode              (tModalBank* const, int mode, float ratio, float decay, float gain);
+    void    tModalBank_setNumModes          (tModalBank* const, int numModes);
+    void    tModalBank_setFundamental       (tModalBank* const, float freq);
+    void    tModalBank_setDecayScale        (tModalBank* const, float scale);
+    void    tModalBank_setSampleRate        (tModalBank* const, float sr);
+    
+    // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~
+    
+    
     /*!
      @defgroup treedtable tReedTable
      @ingroup physical
@@ -310,6 +310,318 @@ extern "C" {
     void    tDattorroReverb_setFeedbackGain   (tDattorroReverb* const, float gain);
     void    tDattorroReverb_setSampleRate     (tDattorroReverb* const, float sr);
     
+    //==============================================================================
+    
+    /*!
+     @defgroup tdattorroreverbblock tDattorroReverbBlock
+     @ingroup reverb
+     @brief Block-processing Dattorro plate reverb.
+     @details Block-processing version of tDattorroReverb. All delay lines live in a single allocation with power-of-two lengths, and all filter and delay state is kept in this one struct rather than in separate objects. The two tank halves run through the same loop body, indexed by lane. Each lane reads its own delay lines, so this loop is not vectorized; the speedup over tDattorroReverb comes from the shared allocation, masked wrapping, inline state and updating the modulated allpass delays once per internal sub-block of DATTORRO_BLOCK_CHUNK samples, linearly interpolated in between. The output taps are Hermite interpolated like tDattorroReverb's. The modulation is smoother than tDattorroReverb's per-sample LFO, so the two do not match sample for sample.
+     @{
+     
+     @fn void    tDattorroReverbBlock_init              (tDattorroReverbBlock* const, LEAF* const leaf)
+     @brief Initialize a tDattorroReverbBlock to the default mempool of a LEAF instance.
+     @param reverb A pointer to the tDattorroReverbBlock to initialize.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tDattorroReverbBlock_initToPool        (tDattorroReverbBlock* const, tMempool* const)
+     @brief Initialize a tDattorroReverbBlock to a specified mempool.
+     @param reverb A pointer to the tDattorroReverbBlock to initialize.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tDattorroReverbBlock_free              (tDattorroReverbBlock* const)
+     @brief Free a tDattorroReverbBlock from its mempool.
+     @param reverb A pointer to the tDattorroReverbBlock to free.
+     
+     @fn void    tDattorroReverbBlock_clear             (tDattorroReverbBlock* const)
+     @brief Clear all delay lines and filter states.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     
+     @fn void    tDattorroReverbBlock_tickBlock         (tDattorroReverbBlock* const, float* input, float* output, int numSamples)
+     @brief Process a block of mono input to mono output. Input and output may point to the same buffer.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param input The input block.
+     @param output The output block.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tDattorroReverbBlock_tickStereoBlock   (tDattorroReverbBlock* const, float* input, float* outputL, float* outputR, int numSamples)
+     @brief Process a block of mono input to stereo output. Input may point to the same buffer as one of the outputs.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param input The input block.
+     @param outputL The left output block.
+     @param outputR The right output block.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tDattorroReverbBlock_setMix            (tDattorroReverbBlock* const, float mix)
+     @brief Set the wet/dry mix.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param mix The mix, from 0 (dry) to 1 (wet).
+     
+     @fn void    tDattorroReverbBlock_setFreeze         (tDattorroReverbBlock* const, int freeze)
+     @brief Freeze the tank. While frozen the input is muted, the tank allpass gain is set to 1 and the modulation stops.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param freeze 1 to freeze, 0 to release.
+     
+     @fn void    tDattorroReverbBlock_setHP             (tDattorroReverbBlock* const, float freq)
+     @brief Set the cutoff of the highpass filters in the tank feedback.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param freq The cutoff in Hz, 20 to 20000.
+     
+     @fn void    tDattorroReverbBlock_setSize           (tDattorroReverbBlock* const, float size)
+     @brief Set the room size, scaling every delay in the tank and the output taps.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param size The size, from 0 to 1 of the maximum. Changes glide over a few sub-blocks.
+     
+     @fn void    tDattorroReverbBlock_setInputDelay     (tDattorroReverbBlock* const, float preDelay)
+     @brief Set the predelay before the input diffusers.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param preDelay The predelay in milliseconds, 0 to 200.
+     
+     @fn void    tDattorroReverbBlock_setInputFilter    (tDattorroReverbBlock* const, float freq)
+     @brief Set the cutoff of the one-pole lowpass on the input.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param freq The cutoff in Hz, 0 to 20000.
+     
+     @fn void    tDattorroReverbBlock_setFeedbackFilter (tDattorroReverbBlock* const, float freq)
+     @brief Set the cutoff of the one-pole lowpass filters in the tank feedback.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param freq The cutoff in Hz, 0 to 20000.
+     
+     @fn void    tDattorroReverbBlock_setFeedbackGain   (tDattorroReverbBlock* const, float gain)
+     @brief Set the gain of the tank feedback, which sets the decay time.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     @param gain The feedback gain. Values of 1 or more do not decay.
+     
+     @fn void    tDattorroReverbBlock_setSampleRate     (tDattorroReverbBlock* const, float sr)
+     @brief Set the sample rate. Reallocates the delay memory.
+     @param reverb A pointer to the relevant tDattorroReverbBlock.
+     
+     @} */
+    
+#define DATTORRO_BLOCK_CHUNK 32
+    
+    typedef struct _tDattorroReverbBlock
+    {
+        
+        tMempool mempool;
+        
+        float   sampleRate;
+        float   predelay;
+        float   input_filter;
+        float   feedback_filter;
+        float   feedback_gain;
+        float   hp_freq;
+        float   mix;
+        int     frozen;
+        
+        float   size, size_max, t;
+        
+        // all delay memory, carved into power-of-two lines
+        float*  mem;
+        uint32_t memSize;
+        
+        uint32_t writePos;
+        
+        // INPUT
+        float*  in_delay;
+        uint32_t in_delay_mask;
+        float   in_delay_length;
+        
+        float   in_b0, in_lp;
+        
+        float*  in_ap[4];
+        uint32_t in_ap_mask;
+        float   in_ap_length[4];
+        float   in_ap_gain[4];
+        float   in_ap_last[4];
+        
+        // TANK, lane 0 is feedback 1 and lane 1 is feedback 2
+        float*  ap[2];
+        float*  d1[2];
+        float*  d2[2];
+        float*  d3[2];
+        uint32_t ap_mask, d1_mask, d2_mask, d3_mask;
+        
+        float   ap_base[2];
+        float   ap_depth;
+        float   ap_delay[2];
+        float   ap_gain;
+        float   ap_last[2];
+        
+        float   d_delay[2][3];
+        float   d_target[2][3];
+        
+        float   fb_b0;
+        float   lp[2];
+        float   hp_R;
+        float   hp_xs[2], hp_ys[2];
+        float   d2_last[2];
+        
+        float   lfo_phase[2];
+        float   lfo_inc[2];
+        
+        // output taps, as the offset of the older inner Hermite point from the
+        // write position, and the weights of the four points around it
+        uint32_t tap[14];
+        float   tap_w[14][4];
+    } _tDattorroReverbBlock;
+    
+    typedef _tDattorroReverbBlock* tDattorroReverbBlock;
+    
+    void    tDattorroReverbBlock_init              (tDattorroReverbBlock* const, LEAF* const leaf);
+    void    tDattorroReverbBlock_initToPool        (tDattorroReverbBlock* const, tMempool* const);
+    void    tDattorroReverbBlock_free              (tDattorroReverbBlock* const);
+    
+    void    tDattorroReverbBlock_clear             (tDattorroReverbBlock* const);
+    void    tDattorroReverbBlock_tickBlock         (tDattorroReverbBlock* const, float* input, float* output, int numSamples);
+    void    tDattorroReverbBlock_tickStereoBlock   (tDattorroReverbBlock* const, float* input, float* outputL, float* outputR, int numSamples);
+    void    tDattorroReverbBlock_setMix            (tDattorroReverbBlock* const, float mix);
+    void    tDattorroReverbBlock_setFreeze         (tDattorroReverbBlock* const, int freeze);
+    void    tDattorroReverbBlock_setHP             (tDattorroReverbBlock* const, float freq);
+    void    tDattorroReverbBlock_setSize           (tDattorroReverbBlock* const, float size);
+    void    tDattorroReverbBlock_setInputDelay     (tDattorroReverbBlock* const, float preDelay);
+    void    tDattorroReverbBlock_setInputFilter    (tDattorroReverbBlock* const, float freq);
+    void    tDattorroReverbBlock_setFeedbackFilter (tDattorroReverbBlock* const, float freq);
+    void    tDattorroReverbBlock_setFeedbackGain   (tDattorroReverbBlock* const, float gain);
+    void    tDattorroReverbBlock_setSampleRate     (tDattorroReverbBlock* const, float sr);
+    
+    //==============================================================================
+    
+    /*!
+     @defgroup tfdnreverb tFDNReverb
+     @ingroup reverb
+     @brief Feedback delay network reverb with a Hadamard or Householder feedback matrix.
+     @details Feedback delay network reverb. Each line has its own decay gain (set from the T60) and one-pole damping filter. All lines share a single power-of-two masked allocation and write position, and the feedback matrix is applied as a fast Walsh-Hadamard transform (N log N adds) or as a Householder reflection (2N adds), so the whole network is a handful of short loops over contiguous arrays.
+     @{
+     
+     @fn void    tFDNReverb_init                 (tFDNReverb* const, int numLines, LEAF* const leaf)
+     @brief Initialize a tFDNReverb to the default mempool of a LEAF instance.
+     @param reverb A pointer to the tFDNReverb to initialize.
+     @param numLines The number of delay lines. Rounded up to a power of two between 4 and FDN_MAX_LINES. 8 or 16 is recommended.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tFDNReverb_initToPool           (tFDNReverb* const, int numLines, tMempool* const)
+     @brief Initialize a tFDNReverb to a specified mempool.
+     @param reverb A pointer to the tFDNReverb to initialize.
+     @param numLines The number of delay lines. Rounded up to a power of two between 4 and FDN_MAX_LINES. 8 or 16 is recommended.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tFDNReverb_free                 (tFDNReverb* const)
+     @brief Free a tFDNReverb from its mempool.
+     @param reverb A pointer to the tFDNReverb to free.
+     
+     @fn void    tFDNReverb_clear                (tFDNReverb* const)
+     @brief Clear all delay lines and filter states.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @fn float   tFDNReverb_tick                 (tFDNReverb* const, float input)
+     @brief Process one sample of mono input to mono output.
+     @param reverb A pointer to the relevant tFDNReverb.
+     @param input The input sample.
+     @return The output sample.
+     
+     @fn void    tFDNReverb_tickBlock            (tFDNReverb* const, float* input, float* output, int numSamples)
+     @brief Process a block of mono input to mono output. Input and output may point to the same buffer.
+     @param reverb A pointer to the relevant tFDNReverb.
+     @param input The input block.
+     @param output The output block.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tFDNReverb_tickStereoBlock      (tFDNReverb* const, float* input, float* outputL, float* outputR, int numSamples)
+     @brief Process a block of mono input to stereo output.
+     @param reverb A pointer to the relevant tFDNReverb.
+     @param input The input block.
+     @param outputL The left output block.
+     @param outputR The right output block.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tFDNReverb_tickMultichannelBlock(tFDNReverb* const, float* input, float** outputs, int numChannels, int numSamples)
+     @brief Process a block of mono input to any number of decorrelated outputs. Output channel c is taken from lines c, c + numChannels, c + 2 * numChannels, and so on.
+     @param reverb A pointer to the relevant tFDNReverb.
+     @param input The input block.
+     @param outputs An array of numChannels output blocks.
+     @param numChannels The number of output channels. Cannot be greater than the number of lines.
+     @param numSamples The number of samples in the block.
+     
+     @fn void    tFDNReverb_setT60               (tFDNReverb* const, float t60)
+     @brief Set reverb time in seconds.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @fn void    tFDNReverb_setDamping           (tFDNReverb* const, float freq)
+     @brief Set the cutoff frequency of the damping filter in each line.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @fn void    tFDNReverb_setSize              (tFDNReverb* const, float size)
+     @brief Set the size of the network, from 0.1 to 1.0, scaling all delay lengths.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @fn void    tFDNReverb_setMatrix            (tFDNReverb* const, FDNMatrix matrix)
+     @brief Set the feedback matrix, either FDNHadamard or FDNHouseholder.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @fn void    tFDNReverb_setMix               (tFDNReverb* const, float mix)
+     @brief Set mix between dry input and wet output signal.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @fn void    tFDNReverb_setSampleRate        (tFDNReverb* const, float sr)
+     @brief Set the sample rate. Reallocates the delay memory.
+     @param reverb A pointer to the relevant tFDNReverb.
+     
+     @} */
+    
+#define FDN_MAX_LINES 16
+    
+    typedef enum FDNMatrix
+    {
+        FDNHadamard = 0,
+        FDNHouseholder,
+        FDNMatrixNil
+    } FDNMatrix;
+    
+    typedef struct _tFDNReverb
+    {
+        
+        tMempool mempool;
+        
+        float mix, t60, damping, size;
+        
+        float sampleRate;
+        float invSampleRate;
+        
+        int numLines;
+        FDNMatrix matrix;
+        
+        // numLines lines of stride samples each, sharing one write position
+        float* buff;
+        uint32_t stride, mask;
+        uint32_t writePos;
+        
+        uint32_t length[FDN_MAX_LINES];
+        float decay[FDN_MAX_LINES];
+        float lowpassState[FDN_MAX_LINES];
+        float inGain[FDN_MAX_LINES];
+        float outGain[FDN_MAX_LINES];
+        float dampingCoeff;
+    } _tFDNReverb;
+    
+    typedef _tFDNReverb* tFDNReverb;
+    
+    void    tFDNReverb_init                 (tFDNReverb* const, int numLines, LEAF* const leaf);
+    void    tFDNReverb_initToPool           (tFDNReverb* const, int numLines, tMempool* const);
+    void    tFDNReverb_free                 (tFDNReverb* const);
+    
+    void    tFDNReverb_clear                (tFDNReverb* const);
+    float   tFDNReverb_tick                 (tFDNReverb* const, float input);
+    void    tFDNReverb_tickBlock            (tFDNReverb* const, float* input, float* output, int numSamples);
+    void    tFDNReverb_tickStereoBlock      (tFDNReverb* const, float* input, float* outputL, float* outputR, int numSamples);
+    void    tFDNReverb_tickMultichannelBlock(tFDNReverb* const, float* input, float** outputs, int numChannels, int numSamples);
+    void    tFDNReverb_setT60               (tFDNReverb* const, float t60);
+    void    tFDNReverb_setDamping           (tFDNReverb* const, float freq);
+    void    tFDNReverb_setSize              (tFDNReverb* const, float size);
+    void    tFDNReverb_setMatrix            (tFDNReverb* const, FDNMatrix matrix);
+    void    tFDNReverb_setMix               (tFDNReverb* const, float mix);
+    void    tFDNReverb_setSampleRate        (tFDNReverb* const, float sr);
+    
 #ifdef __cplusplus
 }
 #endif
@@ -496,6 +496,113 @@ extern "C" {
     void    tMBSampler_setLength          (tMBSampler* const, int32_t length);
     void    tMBSampler_setRate            (tMBSampler* const, float rate);
     
+    //==============================================================================
+    
+    /*!
+     @defgroup tgranulator tGranulator
+     @ingroup sampling
+     @brief Granular playback engine reading from a tBuffer.
+     @details Granular playback engine reading from a tBuffer. Grains are kept in a fixed-capacity pool allocated on initialization, stored as parallel arrays (position, rate, window phase, gain) so that all active grains can be rendered per block against a single shared window table. Active grains are kept packed at the front of the pool, so starting and finishing a grain never allocates or frees memory.
+     @{
+     
+     @fn void    tGranulator_init               (tGranulator* const, tBuffer* const, int maxGrains, LEAF* const leaf)
+     @brief Initialize a tGranulator to the default mempool of a LEAF instance.
+     @param granulator A pointer to the tGranulator to initialize.
+     @param buffer A pointer to a tBuffer to read grains from. Multiple tGranulators can share one tBuffer.
+     @param maxGrains The maximum number of simultaneous grains.
+     @param leaf A pointer to the leaf instance.
+     
+     @fn void    tGranulator_initToPool         (tGranulator* const, tBuffer* const, int maxGrains, tMempool* const)
+     @brief Initialize a tGranulator to a specified mempool.
+     @param granulator A pointer to the tGranulator to initialize.
+     @param buffer A pointer to a tBuffer to read grains from. Multiple tGranulators can share one tBuffer.
+     @param maxGrains The maximum number of simultaneous grains.
+     @param mempool A pointer to the tMempool to use.
+     
+     @fn void    tGranulator_free               (tGranulator* const)
+     @brief Free a tGranulator from its mempool.
+     @param granulator A pointer to the tGranulator to free.
+     
+     @fn float   tGranulator_tick               (tGranulator* const)
+     @brief Render one sample of all active grains.
+     @param granulator A pointer to the relevant tGranulator.
+     @return The sum of all active grains.
+     
+     @fn void    tGranulator_tickBlock          (tGranulator* const, float* output, int numSamples)
+     @brief Render a block of all active grains. The output is overwritten, not added to.
+     @param granulator A pointer to the relevant tGranulator.
+     @param output The output block.
+     @param numSamples The number of samples to render.
+     
+     @fn int     tGranulator_addGrain           (tGranulator* const, float start, float length, float rate, float gain)
+     @brief Start a new grain.
+     @param granulator A pointer to the relevant tGranulator.
+     @param start The position in the buffer in samples from which the grain starts reading. Positions outside the recorded length wrap around it.
+     @param length The length of the grain in samples at the LEAF sample rate.
+     @param rate The playback rate of the grain. Negative rates read backwards.
+     @param gain The gain of the grain.
+     @return 1 if the grain was started, 0 if the pool is full, the buffer is empty or start, length or rate is not finite.
+     
+     @fn void    tGranulator_setSample          (tGranulator* const, tBuffer* const)
+     @brief Set the buffer to read grains from. Stops all active grains.
+     @param granulator A pointer to the relevant tGranulator.
+     @param buffer A pointer to the new tBuffer.
+     
+     @fn void    tGranulator_clear              (tGranulator* const)
+     @brief Stop all active grains.
+     @param granulator A pointer to the relevant tGranulator.
+     
+     @fn int     tGranulator_getNumActiveGrains (tGranulator* const)
+     @brief Get the number of currently active grains.
+     @param granulator A pointer to the relevant tGranulator.
+     @return The number of active grains.
+     
+     @fn void    tGranulator_setSampleRate      (tGranulator* const, float sr)
+     @brief Set the sample rate the granulator plays back at. Grains already playing are rescaled to keep their pitch.
+     @param granulator A pointer to the relevant tGranulator.
+     @param sampleRate The new sample rate.
+     
+     @} */
+    
+#define GRANULATOR_WINDOW_SIZE 1024
+    
+    typedef struct _tGranulator
+    {
+        
+        tMempool mempool;
+        
+        tBuffer samp;
+        
+        float invSampleRate;
+        float rateFactor;
+        
+        int maxGrains;
+        int numActive;
+        
+        // grain pool, active grains packed at [0, numActive)
+        float* pos;
+        float* rate;
+        float* phase;
+        float* phaseInc;
+        float* gain;
+        
+        float window[GRANULATOR_WINDOW_SIZE + 2];
+    } _tGranulator;
+    
+    typedef _tGranulator* tGranulator;
+    
+    void    tGranulator_init               (tGranulator* const, tBuffer* const, int maxGrains, LEAF* const leaf);
+    void    tGranulator_initToPool         (tGranulator* const, tBuffer* const, int maxGrains, tMempool* const);
+    void    tGranulator_free               (tGranulator* const);
+    
+    float   tGranulator_tick               (tGranulator* const);
+    void    tGranulator_tickBlock          (tGranulator* const, float* output, int numSamples);
+    int     tGranulator_addGrain           (tGranulator* const, float start, float length, float rate, float gain);
+    void    tGranulator_setSample          (tGranulator* const, tBuffer* const);
+    void    tGranulator_clear              (tGranulator* const);
+    int     tGranulator_getNumActiveGrains (tGranulator* const);
+    void    tGranulator_setSampleRate      (tGranulator* const, float sr);
+    
 #ifdef __cplusplus
 }
 #endif
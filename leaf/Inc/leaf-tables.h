@@ -40,6 +40,16 @@ extern "C" {
     extern const float __leaf_table_fir32XHigh[512];
     extern const float __leaf_table_fir64XHigh[1024];
     
+#define HALFBAND_COEFFS_SIZE 6
+    extern const float* __leaf_tableref_halfbandCoeffs[HALFBAND_COEFFS_SIZE];
+    extern const int __leaf_tablesize_halfbandNumCoeffs[HALFBAND_COEFFS_SIZE];
+    extern const float __leaf_table_halfband2XLow[6];
+    extern const float __leaf_table_halfband4XLow[4];
+    extern const float __leaf_table_halfband8XLow[3];
+    extern const float __leaf_table_halfband2XHigh[8];
+    extern const float __leaf_table_halfband4XHigh[5];
+    extern const float __leaf_table_halfband8XHigh[4];
+    
 //    typedef enum TableName
 //    {
 //        T20 = 0,
@@ -116,6 +126,14 @@ extern "C" {
     extern const float_value_delta step_dd_table[];
     extern const  float             slope_dd_table[];
     
+#define ADAA_TABLE_SIZE 257
+    extern const float __leaf_table_adaaTanh[ADAA_TABLE_SIZE];
+    extern const float __leaf_table_adaaTanhF1[ADAA_TABLE_SIZE];
+    extern const double __leaf_table_adaaTanhF2[ADAA_TABLE_SIZE];
+    extern const float __leaf_table_adaaShaper[ADAA_TABLE_SIZE];
+    extern const float __leaf_table_adaaShaperF1[ADAA_TABLE_SIZE];
+    extern const double __leaf_table_adaaShaperF2[ADAA_TABLE_SIZE];
+    
     /*! @} */
     
     //==============================================================================
@@ -62,8 +62,7 @@ float   tEnvelopeFollower_tick(tEnvelopeFollower* const ef, float x)
     //ef->y = envelope_pow[(uint16_t)(ef->y * (float)UINT16_MAX)] * ef->d_coeff; //not quite the right behavior - too much loss of precision?
     //ef->y = powf(ef->y, 1.000009f) * ef->d_coeff;  // too expensive
     
-#ifdef NO_DENORMAL_CHECK
-#else
+#if !LEAF_NO_DENORMAL_CHECK
     if( e->y < VSF)   e->y = 0.0f;
 #endif
     return e->y;
@@ -18,6 +18,112 @@
 
 #endif
 
+// Wrap a buffer index that has run at most one buffer length past either end.
+// Delays allocated with a power-of-two maxDelay carry a nonzero bufferMask and
+// wrap with a single AND instead of compares.
+static inline uint32_t delayWrap(int32_t idx, uint32_t maxDelay, uint32_t bufferMask)
+{
+    if (bufferMask) return (uint32_t) idx & bufferMask;
+    
+    while (idx < 0) idx += maxDelay;
+    while (idx >= (int32_t) maxDelay) idx -= maxDelay;
+    return (uint32_t) idx;
+}
+
+// Block helpers: walk the ring in contiguous spans so the inner loops are plain
+// array copies and multiply-adds with no per-sample wrap checks.
+static uint32_t delayWriteSpan(float* buff, uint32_t size, uint32_t inPoint, float* input, float gain, int numSamples)
+{
+    while (numSamples > 0)
+    {
+        int run = size - inPoint;
+        if (run > numSamples) run = numSamples;
+        
+        float* dst = buff + inPoint;
+        if (gain == 1.0f) memcpy(dst, input, sizeof(float) * run);
+        else for (int i = 0; i < run; i++) dst[i] = input[i] * gain;
+        
+        input += run;
+        numSamples -= run;
+        inPoint += run;
+        if (inPoint == size) inPoint = 0;
+    }
+    return inPoint;
+}
+
+static uint32_t delayReadSpan(float* buff, uint32_t size, uint32_t outPoint, float* output, int numSamples)
+{
+    while (numSamples > 0)
+    {
+        int run = size - outPoint;
+        if (run > numSamples) run = numSamples;
+        
+        memcpy(output, buff + outPoint, sizeof(float) * run);
+        
+        output += run;
+        numSamples -= run;
+        outPoint += run;
+        if (outPoint == size) outPoint = 0;
+    }
+    return outPoint;
+}
+
+static uint32_t delayReadLinearSpan(float* buff, uint32_t size, uint32_t outPoint, float alpha, float omAlpha, float* output, int numSamples)
+{
+    while (numSamples > 0)
+    {
+        // the last slot interpolates across the wrap
+        if (outPoint == size - 1)
+        {
+            *output++ = buff[outPoint] * omAlpha + buff[0] * alpha;
+            numSamples--;
+            outPoint = 0;
+            continue;
+        }
+        
+        int run = size - 1 - outPoint;
+        if (run > numSamples) run = numSamples;
+        
+        float* src = buff + outPoint;
+        for (int i = 0; i < run; i++) output[i] = src[i] * omAlpha + src[i+1] * alpha;
+        
+        output += run;
+        numSamples -= run;
+        outPoint += run;
+    }
+    return outPoint;
+}
+
+static uint32_t delayReadHermiteSpan(float* buff, uint32_t mask, uint32_t outPoint, float alpha, float* output, int numSamples)
+{
+    while (numSamples > 0)
+    {
+        // contiguous while all four points stay inside the buffer
+        int run = (int) mask - 1 - (int) outPoint;
+        if (outPoint == 0 || run <= 0)
+        {
+            *output++ = LEAF_interpolate_hermite_x(buff[(outPoint - 1) & mask],
+                                                   buff[outPoint],
+                                                   buff[(outPoint + 1) & mask],
+                                                   buff[(outPoint + 2) & mask],
+                                                   alpha);
+            numSamples--;
+            outPoint = (outPoint + 1) & mask;
+            continue;
+        }
+        if (run > numSamples) run = numSamples;
+        
+        float* src = buff + outPoint;
+        for (int i = 0; i < run; i++)
+            output[i] = LEAF_interpolate_hermite_x(src[i-1], src[i], src[i+1], src[i+2], alpha);
+        
+        output += run;
+        numSamples -= run;
+        outPoint = (outPoint + run) & mask;
+    }
+    return outPoint;
+}
+
 // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ Delay ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ //
 void    tDelay_init (tDelay* const dl, uint32_t delay, uint32_t maxDelay, LEAF* const leaf)
 {
@@ -31,6 +137,7 @@ void    tDelay_initToPool   (tDelay* const dl, uint32_t delay, uint32_t maxDelay
     d->mempool = m;
 
     d->maxDelay = maxDelay;
+    d->bufferMask = ((maxDelay != 0) && ((maxDelay & (maxDelay - 1)) == 0)) ? maxDelay - 1 : 0;
 
     d->delay = delay;
 
@@ -80,6 +187,32 @@ float   tDelay_tick (tDelay* const dl, float input)
     return d->lastOut;
 }
 
+void    tDelay_tickBlock (tDelay* const dl, float* input, float* output, int numSamples)
+{
+    _tDelay* d = *dl;
+    
+    if (numSamples <= 0) return;
+    
+    d->lastIn = input[numSamples - 1];
+    
+    // Writing a chunk before reading it matches per-sample ticking as long as
+    // the chunk doesn't lap the read head.
+    uint32_t dist = delayWrap((int32_t) d->inPoint - (int32_t) d->outPoint, d->maxDelay, d->bufferMask);
+    int chunk = d->maxDelay - dist;
+    
+    while (numSamples > 0)
+    {
+        int n = (numSamples < chunk) ? numSamples : chunk;
+        d->inPoint = delayWriteSpan(d->buff, d->maxDelay, d->inPoint, input, d->gain, n);
+        d->outPoint = delayReadSpan(d->buff, d->maxDelay, d->outPoint, output, n);
+        input += n;
+        output += n;
+        numSamples -= n;
+    }
+    
+    d->lastOut = output[-1];
+}
+
 void     tDelay_setDelay (tDelay* const dl, uint32_t delay)
 {
     _tDelay* d = *dl;
@@ -98,7 +231,7 @@ float tDelay_tapOut (tDelay* const dl, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
 
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
 
     return d->buff[tap];
 
@@ -111,7 +244,7 @@ void tDelay_tapIn (tDelay* const dl, float value, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
     
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
     
     d->buff[tap] = value;
 }
@@ -123,7 +256,7 @@ float tDelay_addTo (tDelay* const dl, float value, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
     
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
     
     return (d->buff[tap] += value);
 }
@@ -172,6 +305,7 @@ void tLinearDelay_initToPool  (tLinearDelay* const dl, float delay, uint32_t max
     d->mempool = m;
 
     d->maxDelay = maxDelay;
+    d->bufferMask = ((maxDelay != 0) && ((maxDelay & (maxDelay - 1)) == 0)) ? maxDelay - 1 : 0;
 
     if (delay > maxDelay)   d->delay = maxDelay;
     else if (delay < 0.0f)  d->delay = 0.0f;
@@ -231,6 +365,37 @@ float   tLinearDelay_tick (tLinearDelay* const dl, float input)
     return d->lastOut;
 }
 
+void    tLinearDelay_tickBlock (tLinearDelay* const dl, float* input, float* output, int numSamples)
+{
+    _tLinearDelay* d = *dl;
+    
+    if (numSamples <= 0) return;
+    
+    uint32_t dist = delayWrap((int32_t) d->inPoint - (int32_t) d->outPoint, d->maxDelay, d->bufferMask);
+    
+    // Under one sample of delay the interpolation reads ahead of the write
+    // head, so only per-sample ticking gives the same result.
+    if (dist < 1)
+    {
+        for (int i = 0; i < numSamples; i++) output[i] = tLinearDelay_tick(dl, input[i]);
+        return;
+    }
+    
+    int chunk = d->maxDelay - dist;
+    
+    while (numSamples > 0)
+    {
+        int n = (numSamples < chunk) ? numSamples : chunk;
+        d->inPoint = delayWriteSpan(d->buff, d->maxDelay, d->inPoint, input, d->gain, n);
+        d->outPoint = delayReadLinearSpan(d->buff, d->maxDelay, d->outPoint, d->alpha, d->omAlpha, output, n);
+        input += n;
+        output += n;
+        numSamples -= n;
+    }
+    
+    d->lastOut = output[-1];
+}
+
 void   tLinearDelay_tickIn (tLinearDelay* const dl, float input)
 {
     _tLinearDelay* d = *dl;
@@ -285,7 +450,7 @@ float tLinearDelay_tapOut (tLinearDelay* const dl, uint32_t tapDelay)
 
     int32_t tap = d->inPoint - tapDelay - 1;
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
 
     return d->buff[tap];
 }
@@ -297,7 +462,7 @@ void tLinearDelay_tapIn (tLinearDelay* const dl, float value, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
 
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
 
     d->buff[tap] = value;
 }
@@ -309,7 +474,7 @@ float tLinearDelay_addTo (tLinearDelay* const dl, float value, uint32_t tapDelay
     int32_t tap = d->inPoint - tapDelay - 1;
 
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
     
     return (d->buff[tap] += value);
 }
@@ -439,6 +604,35 @@ float   tHermiteDelay_tick (tHermiteDelay* const dl, float input)
     return d->lastOut;
 }
 
+void    tHermiteDelay_tickBlock (tHermiteDelay* const dl, float* input, float* output, int numSamples)
+{
+    _tHermiteDelay* d = *dl;
+    
+    if (numSamples <= 0) return;
+    
+    uint32_t dist = (d->inPoint - d->outPoint) & d->bufferMask;
+    int chunk = d->maxDelay - dist - 1;
+    
+    // The four interpolation points reach two samples ahead of the read head.
+    if (dist < 2 || chunk < 1)
+    {
+        for (int i = 0; i < numSamples; i++) output[i] = tHermiteDelay_tick(dl, input[i]);
+        return;
+    }
+    
+    while (numSamples > 0)
+    {
+        int n = (numSamples < chunk) ? numSamples : chunk;
+        d->inPoint = delayWriteSpan(d->buff, d->maxDelay, d->inPoint, input, d->gain, n);
+        d->outPoint = delayReadHermiteSpan(d->buff, d->bufferMask, d->outPoint, d->alpha, output, n);
+        input += n;
+        output += n;
+        numSamples -= n;
+    }
+    
+    d->lastOut = output[-1];
+}
+
 void   tHermiteDelay_tickIn (tHermiteDelay* const dl, float input)
 {
     _tHermiteDelay* d = *dl;
@@ -575,6 +769,7 @@ void tAllpassDelay_initToPool  (tAllpassDelay* const dl, float delay, uint32_t m
     d->mempool = m;
 
     d->maxDelay = maxDelay;
+    d->bufferMask = ((maxDelay != 0) && ((maxDelay & (maxDelay - 1)) == 0)) ? maxDelay - 1 : 0;
 
     if (delay > maxDelay)   d->delay = maxDelay;
     else if (delay < 0.0f)  d->delay = 0.0f;
@@ -635,6 +830,47 @@ float tAllpassDelay_tick (tAllpassDelay* const dl, float input)
     return d->lastOut;
 }
 
+void    tAllpassDelay_tickBlock (tAllpassDelay* const dl, float* input, float* output, int numSamples)
+{
+    _tAllpassDelay* d = *dl;
+    
+    if (numSamples <= 0) return;
+    
+    uint32_t dist = delayWrap((int32_t) d->inPoint - (int32_t) d->outPoint, d->maxDelay, d->bufferMask);
+    int chunk = d->maxDelay - dist;
+    
+    float* buff = d->buff;
+    float coeff = d->coeff;
+    float lastOut = d->lastOut;
+    float apInput = d->apInput;
+    uint32_t outPoint = d->outPoint;
+    
+    while (numSamples > 0)
+    {
+        int n = (numSamples < chunk) ? numSamples : chunk;
+        d->inPoint = delayWriteSpan(buff, d->maxDelay, d->inPoint, input, d->gain, n);
+        
+        for (int i = 0; i < n; i++)
+        {
+            float x = buff[outPoint];
+            float out = lastOut * -coeff;
+            out += apInput + (coeff * x);
+            lastOut = out;
+            apInput = x;
+            output[i] = lastOut;
+            if (++outPoint >= d->maxDelay) outPoint = 0;
+        }
+        
+        input += n;
+        output += n;
+        numSamples -= n;
+    }
+    
+    d->outPoint = outPoint;
+    d->lastOut = lastOut;
+    d->apInput = apInput;
+}
+
 void     tAllpassDelay_setDelay (tAllpassDelay* const dl, float delay)
 {
     _tAllpassDelay* d = *dl;
@@ -674,7 +910,7 @@ float tAllpassDelay_tapOut (tAllpassDelay* const dl, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
 
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
 
     return d->buff[tap];
 
@@ -687,7 +923,7 @@ void tAllpassDelay_tapIn (tAllpassDelay* const dl, float value, uint32_t tapDela
     int32_t tap = d->inPoint - tapDelay - 1;
 
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
 
     d->buff[tap] = value;
 }
@@ -699,7 +935,7 @@ float tAllpassDelay_addTo (tAllpassDelay* const dl, float value, uint32_t tapDel
     int32_t tap = d->inPoint - tapDelay - 1;
 
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
 
     return (d->buff[tap] += value);
 }
@@ -748,6 +984,7 @@ void tTapeDelay_initToPool (tTapeDelay* const dl, float delay, uint32_t maxDelay
     d->mempool = m;
 
     d->maxDelay = maxDelay;
+    d->bufferMask = ((maxDelay != 0) && ((maxDelay & (maxDelay - 1)) == 0)) ? maxDelay - 1 : 0;
 
     d->buff = (float*) mpool_alloc(sizeof(float) * maxDelay, m);
 
@@ -794,10 +1031,10 @@ float   tTapeDelay_tick (tTapeDelay* const dl, float input)
     int idx =  (int) d->idx;
     float alpha = d->idx - idx;
 
-    d->lastOut =    LEAF_interpolate_hermite_x (d->buff[((idx - 1) + d->maxDelay) % d->maxDelay],
+    d->lastOut =    LEAF_interpolate_hermite_x (d->buff[delayWrap(idx - 1, d->maxDelay, d->bufferMask)],
                                               d->buff[idx],
-                                              d->buff[(idx + 1) % d->maxDelay],
-                                              d->buff[(idx + 2) % d->maxDelay],
+                                              d->buff[delayWrap(idx + 1, d->maxDelay, d->bufferMask)],
+                                              d->buff[delayWrap(idx + 2, d->maxDelay, d->bufferMask)],
                                               alpha);
 
     float diff = (d->inPoint - d->idx);
@@ -814,6 +1051,46 @@ float   tTapeDelay_tick (tTapeDelay* const dl, float input)
     return 0.0f;
 }
 
+void    tTapeDelay_tickBlock (tTapeDelay* const dl, float* input, float* output, int numSamples)
+{
+    _tTapeDelay* d = *dl;
+    
+    float* buff = d->buff;
+    uint32_t size = d->maxDelay;
+    uint32_t mask = d->bufferMask;
+    uint32_t inPoint = d->inPoint;
+    float pos = d->idx;
+    float inc = d->inc;
+    
+    for (int i = 0; i < numSamples; i++)
+    {
+        buff[inPoint] = input[i] * d->gain;
+        if (++inPoint == size) inPoint = 0;
+        
+        int idx = (int) pos;
+        float alpha = pos - idx;
+        
+        output[i] = LEAF_interpolate_hermite_x (buff[delayWrap(idx - 1, size, mask)],
+                                                buff[idx],
+                                                buff[delayWrap(idx + 1, size, mask)],
+                                                buff[delayWrap(idx + 2, size, mask)],
+                                                alpha);
+        
+        float diff = (inPoint - pos);
+        while (diff < 0.f) diff += size;
+        
+        inc = 1.0f + (diff - d->delay) / d->delay;
+        
+        pos += inc;
+        while (pos >= size) pos -= size;
+    }
+    
+    d->inPoint = inPoint;
+    d->idx = pos;
+    d->inc = inc;
+    if (numSamples > 0) d->lastOut = output[numSamples - 1];
+}
+
 void  tTapeDelay_incrementInPoint(tTapeDelay* const dl)
 {
     _tTapeDelay* d = *dl;
@@ -847,10 +1124,10 @@ float tTapeDelay_tapOut (tTapeDelay* const dl, float tapDelay)
 
     float alpha = tap - idx;
 
-    float samp =    LEAF_interpolate_hermite_x (d->buff[((idx - 1) + d->maxDelay) % d->maxDelay],
+    float samp =    LEAF_interpolate_hermite_x (d->buff[delayWrap(idx - 1, d->maxDelay, d->bufferMask)],
                                               d->buff[idx],
-                                              d->buff[(idx + 1) % d->maxDelay],
-                                              d->buff[(idx + 2) % d->maxDelay],
+                                              d->buff[delayWrap(idx + 1, d->maxDelay, d->bufferMask)],
+                                              d->buff[delayWrap(idx + 2, d->maxDelay, d->bufferMask)],
                                               alpha);
 
     return samp;
@@ -864,7 +1141,7 @@ void tTapeDelay_tapIn (tTapeDelay* const dl, float value, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
     
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
     
     d->buff[tap] = value;
 }
@@ -876,7 +1153,7 @@ float tTapeDelay_addTo (tTapeDelay* const dl, float value, uint32_t tapDelay)
     int32_t tap = d->inPoint - tapDelay - 1;
     
     // Check for wraparound.
-    while ( tap < 0 )   tap += d->maxDelay;
+    tap = delayWrap(tap, d->maxDelay, d->bufferMask);
     
     return (d->buff[tap] += value);
 }
@@ -978,3 +1255,264 @@ int     tRingBuffer_getSize  (tRingBuffer* const ring)
     
     return r->size;
 }
+
+// ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ MultiTapDelay ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ //
+#define MULTITAP_NUM_PARAMS 10
+
+void    tMultiTapDelay_init (tMultiTapDelay* const dl, uint32_t maxDelay, int numTaps, LEAF* const leaf)
+{
+    tMultiTapDelay_initToPool(dl, maxDelay, numTaps, &leaf->mempool);
+}
+
+void    tMultiTapDelay_initToPool (tMultiTapDelay* const dl, uint32_t maxDelay, int numTaps, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tMultiTapDelay* d = *dl = (_tMultiTapDelay*) mpool_alloc(sizeof(_tMultiTapDelay), m);
+    d->mempool = m;
+    LEAF* leaf = d->mempool->leaf;
+    
+    if (numTaps < 1) numTaps = 1;
+    d->numTaps = numTaps;
+    d->maxDelay = maxDelay;
+    
+    // a chunk of headroom lets a whole chunk be written before any tap reads it
+    uint32_t size = LEAF_nextPowerOfTwo(maxDelay + MULTITAP_CHUNK + 2);
+    d->bufferMask = size - 1;
+    d->buff = (float*) mpool_calloc(sizeof(float) * size, m);
+    d->inPoint = 0;
+    
+    d->taps = (float*) mpool_calloc(sizeof(float) * numTaps * MULTITAP_NUM_PARAMS, m);
+    d->delay    = d->taps;
+    d->current  = d->taps + numTaps;
+    d->gain     = d->taps + numTaps * 2;
+    d->gainL    = d->taps + numTaps * 3;
+    d->gainR    = d->taps + numTaps * 4;
+    d->pan      = d->taps + numTaps * 5;
+    d->lfoPhase = d->taps + numTaps * 6;
+    d->lfoInc   = d->taps + numTaps * 7;
+    d->lfoRate  = d->taps + numTaps * 8;
+    d->lfoDepth = d->taps + numTaps * 9;
+    
+    d->sampleRate = leaf->sampleRate;
+    d->invSampleRate = leaf->invSampleRate;
+    
+    for (int i = 0; i < numTaps; i++)
+    {
+        d->pan[i] = 0.5f;
+        tMultiTapDelay_setTapGain(dl, i, 1.0f / numTaps);
+        tMultiTapDelay_setTapDelay(dl, i, (float) maxDelay * (i + 1) / numTaps);
+        d->current[i] = d->delay[i];
+    }
+}
+
+void    tMultiTapDelay_free (tMultiTapDelay* const dl)
+{
+    _tMultiTapDelay* d = *dl;
+    
+    mpool_free((char*)d->taps, d->mempool);
+    mpool_free((char*)d->buff, d->mempool);
+    mpool_free((char*)d, d->mempool);
+}
+
+void    tMultiTapDelay_clear (tMultiTapDelay* const dl)
+{
+    _tMultiTapDelay* d = *dl;
+    
+    memset(d->buff, 0, sizeof(float) * (d->bufferMask + 1));
+}
+
+// Advances a tap's LFO by one chunk and returns the delay it should reach by
+// the end of that chunk.
+static float multiTapTarget(_tMultiTapDelay* d, int t, int n)
+{
+    float target = d->delay[t];
+    
+    if (d->lfoDepth[t] != 0.0f)
+    {
+        d->lfoPhase[t] += d->lfoInc[t] * n;
+        while (d->lfoPhase[t] >= 1.0f) d->lfoPhase[t] -= 1.0f;
+        target += d->lfoDepth[t] * sinf(TWO_PI * d->lfoPhase[t]);
+    }
+    
+    return LEAF_clip(0.0f, target, (float) d->maxDelay);
+}
+
+static inline float multiTapRead(float* buff, uint32_t idx, uint32_t mask, float frac)
+{
+    float a = buff[idx & mask];
+    return a + frac * (buff[(idx - 1) & mask] - a);
+}
+
+// Writes each chunk into the ring first, then sweeps every tap across it.
+// Tap delays glide linearly from their value at the end of the previous chunk,
+// so per-sample work is one interpolated read and a multiply-add per tap.
+static void multiTapProcess(_tMultiTapDelay* d, float* input, float* outputL, float* outputR, int numSamples)
+{
+    float* buff = d->buff;
+    uint32_t mask = d->bufferMask;
+    
+    while (numSamples > 0)
+    {
+        int n = (numSamples < MULTITAP_CHUNK) ? numSamples : MULTITAP_CHUNK;
+        uint32_t w = d->inPoint;
+        
+        for (int i = 0; i < n; i++) buff[(w + i) & mask] = input[i];
+        
+        for (int i = 0; i < n; i++) outputL[i] = 0.0f;
+        if (outputR != NULL) for (int i = 0; i < n; i++) outputR[i] = 0.0f;
+        
+        for (int t = 0; t < d->numTaps; t++)
+        {
+            float target = multiTapTarget(d, t, n);
+            float cur = d->current[t];
+            float step = (target - cur) / n;
+            d->current[t] = target;
+            
+            if (d->gain[t] == 0.0f) continue;
+            
+            float gL = (outputR != NULL) ? d->gainL[t] : d->gain[t];
+            float gR = d->gainR[t];
+            
+            if (step == 0.0f)
+            {
+                // static tap, fixed offset and fraction
+                int32_t di = (int32_t) cur;
+                float f = cur - di;
+                uint32_t idx = (w - di) & mask;
+                if (idx >= 1 && idx + n <= mask + 1)
+                {
+                    // no wrap inside this chunk, read straight from the buffer
+                    float* src = buff + idx;
+                    if (outputR == NULL)
+                        for (int i = 0; i < n; i++) outputL[i] += (src[i] + f * (src[i-1] - src[i])) * gL;
+                    else
+                        for (int i = 0; i < n; i++)
+                        {
+                            float s = src[i] + f * (src[i-1] - src[i]);
+                            outputL[i] += s * gL;
+                            outputR[i] += s * gR;
+                        }
+                }
+                else if (outputR == NULL)
+                    for (int i = 0; i < n; i++) outputL[i] += multiTapRead(buff, idx + i, mask, f) * gL;
+                else
+                    for (int i = 0; i < n; i++)
+                    {
+                        float s = multiTapRead(buff, idx + i, mask, f);
+                        outputL[i] += s * gL;
+                        outputR[i] += s * gR;
+                    }
+            }
+            else
+            {
+                // gliding tap, the delay for sample i is cur + step * (i + 1)
+                if (outputR == NULL)
+                    for (int i = 0; i < n; i++)
+                    {
+                        float dt = cur + step * (i + 1);
+                        int32_t di = (int32_t) dt;
+                        outputL[i] += multiTapRead(buff, w + i - di, mask, dt - di) * gL;
+                    }
+                else
+                    for (int i = 0; i < n; i++)
+                    {
+                        float dt = cur + step * (i + 1);
+                        int32_t di = (int32_t) dt;
+                        float s = multiTapRead(buff, w + i - di, mask, dt - di);
+                        outputL[i] += s * gL;
+                        outputR[i] += s * gR;
+                    }
+            }
+        }
+        
+        d->inPoint = (w + n) & mask;
+        input += n;
+        outputL += n;
+        if (outputR != NULL) outputR += n;
+        numSamples -= n;
+    }
+}
+
+float   tMultiTapDelay_tick (tMultiTapDelay* const dl, float input)
+{
+    _tMultiTapDelay* d = *dl;
+    
+    float out;
+    multiTapProcess(d, &input, &out, NULL, 1);
+    return out;
+}
+
+void    tMultiTapDelay_tickBlock (tMultiTapDelay* const dl, float* input, float* output, int numSamples)
+{
+    _tMultiTapDelay* d = *dl;
+    multiTapProcess(d, input, output, NULL, numSamples);
+}
+
+void    tMultiTapDelay_tickStereoBlock (tMultiTapDelay* const dl, float* input, float* outputL, float* outputR, int numSamples)
+{
+    _tMultiTapDelay* d = *dl;
+    multiTapProcess(d, input, outputL, outputR, numSamples);
+}
+
+void    tMultiTapDelay_setTapDelay (tMultiTapDelay* const dl, int tap, float delay)
+{
+    _tMultiTapDelay* d = *dl;
+    if (tap < 0 || tap >= d->numTaps) return;
+    d->delay[tap] = LEAF_clip(0.0f, delay, (float) d->maxDelay);
+}
+
+float   tMultiTapDelay_getTapDelay (tMultiTapDelay* const dl, int tap)
+{
+    _tMultiTapDelay* d = *dl;
+    if (tap < 0 || tap >= d->numTaps) return 0.0f;
+    return d->delay[tap];
+}
+
+void    tMultiTapDelay_setTapGain (tMultiTapDelay* const dl, int tap, float gain)
+{
+    _tMultiTapDelay* d = *dl;
+    if (tap < 0 || tap >= d->numTaps) return;
+    d->gain[tap] = gain;
+    d->gainL[tap] = gain * cosf(d->pan[tap] * HALF_PI);
+    d->gainR[tap] = gain * sinf(d->pan[tap] * HALF_PI);
+}
+
+void    tMultiTapDelay_setTapPan (tMultiTapDelay* const dl, int tap, float pan)
+{
+    _tMultiTapDelay* d = *dl;
+    if (tap < 0 || tap >= d->numTaps) return;
+    d->pan[tap] = LEAF_clip(0.0f, pan, 1.0f);
+    tMultiTapDelay_setTapGain(dl, tap, d->gain[tap]);
+}
+
+void    tMultiTapDelay_setTapLFO (tMultiTapDelay* const dl, int tap, float rate, float depth)
+{
+    _tMultiTapDelay* d = *dl;
+    if (tap < 0 || tap >= d->numTaps) return;
+    d->lfoRate[tap] = rate;
+    d->lfoInc[tap] = rate * d->invSampleRate;
+    d->lfoDepth[tap] = depth;
+}
+
+void    tMultiTapDelay_setTapLFOPhase (tMultiTapDelay* const dl, int tap, float phase)
+{
+    _tMultiTapDelay* d = *dl;
+    if (tap < 0 || tap >= d->numTaps) return;
+    phase -= (int) phase;
+    if (phase < 0.0f) phase += 1.0f;
+    d->lfoPhase[tap] = phase;
+}
+
+int     tMultiTapDelay_getNumTaps (tMultiTapDelay* const dl)
+{
+    _tMultiTapDelay* d = *dl;
+    return d->numTaps;
+}
+
+void    tMultiTapDelay_setSampleRate (tMultiTapDelay* const dl, float sr)
+{
+    _tMultiTapDelay* d = *dl;
+    d->sampleRate = sr;
+    d->invSampleRate = 1.0f / sr;
+    for (int i = 0; i < d->numTaps; i++) d->lfoInc[i] = d->lfoRate[i] * d->invSampleRate;
+}
@@ -71,7 +71,116 @@ void tSampleReducer_setRatio(tSampleReducer* const sr, float ratio)
 //============================================================================================================
 // Oversampler
 //============================================================================================================
-// Latency is equal to the phase length (numTaps / ratio)
+// Latency is equal to the phase length (numTaps / ratio) for the FIR filters
+
+static const float* oversamplerHalfbandCoeffs(_tOversampler* os, int stage, int* numCoeffs)
+{
+    int idx = (stage < 2 ? stage : 2) + (os->offset > 0 ? 3 : 0);
+    *numCoeffs = __leaf_tablesize_halfbandNumCoeffs[idx];
+    return __leaf_tableref_halfbandCoeffs[idx];
+}
+
+static void oversamplerUpdateLatency(_tOversampler* os)
+{
+    if (os->type != OversamplerIIR)
+    {
+        os->latency = os->phaseLength;
+        return;
+    }
+    
+    // each allpass section delays low frequencies by 2(1-a)/(1+a) samples at
+    // its stage's output rate and the half-band averages the two branches.
+    // The odd branch's extra sample on the way up is taken back on the way
+    // down, which decimates on the newest sample's branch.
+    float latency = 0.0f;
+    for (int s = 0; s < os->numStages; s++)
+    {
+        int numCoeffs;
+        const float* a = oversamplerHalfbandCoeffs(os, s, &numCoeffs);
+        float delay = 0.0f;
+        for (int c = 0; c < numCoeffs; c++) delay += 2.0f * (1.0f - a[c]) / (1.0f + a[c]);
+        latency += delay / (float)(2 << s);
+    }
+    os->latency = (int)(latency + 0.5f);
+}
+
+// One 2x half-band stage. The two allpass branches run at the lower rate and
+// give the even and odd output samples. out may overlap in when in == out + numSamples.
+static void oversamplerHalfbandUp(_tOversampler* os, int stage, float* in, float* out, int numSamples)
+{
+    int numCoeffs;
+    const float* a = oversamplerHalfbandCoeffs(os, stage, &numCoeffs);
+    float* x1 = os->iirState + stage * 4 * OVERSAMPLER_IIR_MAX_COEFFS;
+    float* y1 = x1 + OVERSAMPLER_IIR_MAX_COEFFS;
+    
+    for (int i = 0; i < numSamples; i++)
+    {
+        float b[2] = { in[i], in[i] };
+        for (int c = 0; c < numCoeffs; c++)
+        {
+            float x = b[c & 1];
+            float y = a[c] * (x - y1[c]) + x1[c];
+            x1[c] = x;
+            y1[c] = y;
+            b[c & 1] = y;
+        }
+        out[2 * i] = b[0];
+        out[2 * i + 1] = b[1];
+    }
+}
+
+// One 2x half-band decimating stage, numSamples outputs. out may be the same as in.
+static void oversamplerHalfbandDown(_tOversampler* os, int stage, float* in, float* out, int numSamples)
+{
+    int numCoeffs;
+    const float* a = oversamplerHalfbandCoeffs(os, stage, &numCoeffs);
+    float* x1 = os->iirState + (stage * 4 + 2) * OVERSAMPLER_IIR_MAX_COEFFS;
+    float* y1 = x1 + OVERSAMPLER_IIR_MAX_COEFFS;
+    
+    for (int i = 0; i < numSamples; i++)
+    {
+        float b[2] = { in[2 * i + 1], in[2 * i] };
+        for (int c = 0; c < numCoeffs; c++)
+        {
+            float x = b[c & 1];
+            float y = a[c] * (x - y1[c]) + x1[c];
+            x1[c] = x;
+            y1[c] = y;
+            b[c & 1] = y;
+        }
+        out[i] = 0.5f * (b[0] + b[1]);
+    }
+}
+
+// Runs the stages from the base rate up, each writing to the top of the output
+// so its input is in the upper half of the next stage's output.
+static void oversamplerIIRUpsample(_tOversampler* os, float* input, float* output, int numSamples)
+{
+    float* src = input;
+    int len = numSamples;
+    for (int s = 0; s < os->numStages; s++)
+    {
+        float* dst = output + numSamples * os->ratio - 2 * len;
+        oversamplerHalfbandUp(os, s, src, dst, len);
+        src = dst;
+        len *= 2;
+    }
+}
+
+// Runs the stages from the top rate down, in place in scratch after the first one.
+static void oversamplerIIRDownsample(_tOversampler* os, float* input, float* output, int numSamples, float* scratch)
+{
+    float* src = input;
+    int len = numSamples * os->ratio;
+    for (int s = os->numStages - 1; s >= 0; s--)
+    {
+        len /= 2;
+        float* dst = s == 0 ? output : scratch;
+        oversamplerHalfbandDown(os, s, src, dst, len);
+        src = dst;
+    }
+}
+
 void tOversampler_init (tOversampler* const osr, int ratio, int extraQuality, LEAF* const leaf)
 {
     tOversampler_initToPool(osr, ratio, extraQuality, &leaf->mempool);
@@ -96,8 +205,24 @@ void tOversampler_initToPool (tOversampler* const osr, int maxRatio, int extraQu
         os->numTaps = __leaf_tablesize_firNumTaps[idx];
         os->phaseLength = os->numTaps / os->ratio;
         os->pCoeffs = (float*) __leaf_tableref_firCoeffs[idx];
-        os->upState = (float*) mpool_alloc(sizeof(float) * os->numTaps * 2, m);
-        os->downState = (float*) mpool_alloc(sizeof(float) * os->numTaps * 2, m);
+        // room for a whole block after the filter history, so the block
+        // processing can run in the same state as the single sample functions
+        int downSize = os->numTaps + OVERSAMPLER_BLOCK_SIZE * maxRatio;
+        if (downSize < os->numTaps * 2) downSize = os->numTaps * 2;
+        os->upState = (float*) mpool_alloc(sizeof(float) * (os->numTaps * 2 + OVERSAMPLER_BLOCK_SIZE + OVERSAMPLER_LANES), m);
+        os->downState = (float*) mpool_alloc(sizeof(float) * downSize, m);
+        os->phaseState = (float*) mpool_alloc(sizeof(float) * (os->numTaps + OVERSAMPLER_BLOCK_SIZE + OVERSAMPLER_LANES), m);
+        for (int i = 0; i < os->numTaps * 2 + OVERSAMPLER_BLOCK_SIZE + OVERSAMPLER_LANES; i++) os->upState[i] = 0.0f;
+        for (int i = 0; i < downSize; i++) os->downState[i] = 0.0f;
+        for (int i = 0; i < os->numTaps + OVERSAMPLER_BLOCK_SIZE + OVERSAMPLER_LANES; i++) os->phaseState[i] = 0.0f;
+        
+        // allpass inputs and outputs for the upsampling and downsampling chain of each stage
+        int iirSize = (int)(log2f(maxRatio)) * 4 * OVERSAMPLER_IIR_MAX_COEFFS;
+        os->iirState = (float*) mpool_alloc(sizeof(float) * iirSize, m);
+        for (int i = 0; i < iirSize; i++) os->iirState[i] = 0.0f;
+        os->type = OversamplerFIR;
+        os->numStages = (int)(log2f(os->ratio));
+        oversamplerUpdateLatency(os);
     }
 }
 
@@ -107,6 +232,8 @@ void tOversampler_free (tOversampler* const osr)
     
     mpool_free((char*)os->upState, os->mempool);
     mpool_free((char*)os->downState, os->mempool);
+    mpool_free((char*)os->phaseState, os->mempool);
+    mpool_free((char*)os->iirState, os->mempool);
     mpool_free((char*)os, os->mempool);
 }
 
@@ -123,6 +250,115 @@ float tOversampler_tick(tOversampler* const osr, float input, float* oversample,
     return tOversampler_downsample(osr, oversample);
 }
 
+// Interpolates numSamples inputs into the oversampled buffer. Each polyphase
+// branch is accumulated across the block one coefficient at a time, so the
+// inner loop runs over contiguous samples instead of over taps.
+static void oversamplerUpsampleBlock(_tOversampler* os, float* input, float* output, int numSamples)
+{
+    int ratio = os->ratio;
+    int phaseLen = os->phaseLength;
+    float* state = os->upState;
+    float* x = state + (phaseLen - 1);
+    float acc[OVERSAMPLER_BLOCK_SIZE + OVERSAMPLER_LANES];
+    
+    for (int i = 0; i < numSamples; i++) x[i] = input[i];
+    
+    for (int p = 0; p < ratio; p++)
+    {
+        float* c = os->pCoeffs + (ratio - 1 - p);
+        
+        // lanes of 8 outputs stay in registers over all taps; the last lane
+        // reads past the block into spare state and its extra outputs are dropped
+        for (int i = 0; i < numSamples; i += OVERSAMPLER_LANES)
+        {
+            float a[OVERSAMPLER_LANES] = { 0.0f };
+            for (int k = 0; k < phaseLen; k++)
+            {
+                float ck = c[k * ratio];
+                float* xk = state + i + k;
+                for (int j = 0; j < OVERSAMPLER_LANES; j++) a[j] += xk[j] * ck;
+            }
+            for (int j = 0; j < OVERSAMPLER_LANES; j++) acc[i + j] = a[j];
+        }
+        for (int i = 0; i < numSamples; i++) output[i * ratio + p] = acc[i] * ratio;
+    }
+    
+    // keep the last phaseLen - 1 inputs as history
+    for (int i = 0; i < phaseLen - 1; i++) state[i] = state[numSamples + i];
+}
+
+// Decimates the numSamples * ratio samples after the history in downState.
+// Each phase of the input is gathered into a contiguous run first so the
+// accumulation can again run across the block.
+static void oversamplerDownsampleBlock(_tOversampler* os, float* output, int numSamples)
+{
+    int ratio = os->ratio;
+    int numTaps = os->numTaps;
+    int phaseLen = numTaps / ratio;
+    float* state = os->downState;
+    float* phase = os->phaseState;
+    float acc[OVERSAMPLER_BLOCK_SIZE + OVERSAMPLER_LANES] = { 0.0f };
+    
+    for (int q = 0; q < ratio; q++)
+    {
+        int len = phaseLen - 1 + numSamples;
+        for (int m = 0; m < len; m++) phase[m] = state[m * ratio + q];
+        
+        for (int i = 0; i < numSamples; i += OVERSAMPLER_LANES)
+        {
+            float a[OVERSAMPLER_LANES];
+            for (int j = 0; j < OVERSAMPLER_LANES; j++) a[j] = acc[i + j];
+            for (int k = 0; k < phaseLen; k++)
+            {
+                float ck = os->pCoeffs[k * ratio + q];
+                float* xk = phase + i + k;
+                for (int j = 0; j < OVERSAMPLER_LANES; j++) a[j] += xk[j] * ck;
+            }
+            for (int j = 0; j < OVERSAMPLER_LANES; j++) acc[i + j] = a[j];
+        }
+    }
+    
+    for (int i = 0; i < numSamples; i++) output[i] = acc[i];
+    
+    // keep the last numTaps - 1 samples as history
+    int shift = numSamples * ratio;
+    for (int i = 0; i < numTaps - 1; i++) state[i] = state[shift + i];
+}
+
+void tOversampler_processBlock(tOversampler* const osr, float* input, float* output, int numSamples,
+                               void (*effect)(void* ctx, float* buffer, int numSamples), void* ctx)
+{
+    _tOversampler* os = *osr;
+    
+    if (os->ratio == 1)
+    {
+        if (output != input) for (int i = 0; i < numSamples; i++) output[i] = input[i];
+        if (effect != NULL) effect(ctx, output, numSamples);
+        return;
+    }
+    
+    for (int start = 0; start < numSamples; start += OVERSAMPLER_BLOCK_SIZE)
+    {
+        int n = numSamples - start;
+        if (n > OVERSAMPLER_BLOCK_SIZE) n = OVERSAMPLER_BLOCK_SIZE;
+        
+        if (os->type == OversamplerIIR)
+        {
+            float* oversample = os->downState;
+            oversamplerIIRUpsample(os, input + start, oversample, n);
+            if (effect != NULL) effect(ctx, oversample, n * os->ratio);
+            oversamplerIIRDownsample(os, oversample, output + start, n, oversample);
+            continue;
+        }
+        
+        // the oversampled chunk goes straight into the decimator's state
+        float* oversample = os->downState + (os->numTaps - 1);
+        oversamplerUpsampleBlock(os, input + start, oversample, n);
+        if (effect != NULL) effect(ctx, oversample, n * os->ratio);
+        oversamplerDownsampleBlock(os, output + start, n);
+    }
+}
+
 // From CMSIS DSP Library
 #ifdef ITCMRAM
 void __attribute__ ((section(".itcmram"))) __attribute__ ((aligned (32))) tOversampler_upsample(tOversampler* const osr, float input, float* output)
@@ -138,6 +374,12 @@ void tOversampler_upsample(tOversampler* const osr, float input, float* output)
         return;
     }
     
+    if (os->type == OversamplerIIR)
+    {
+        oversamplerIIRUpsample(os, &input, output, 1);
+        return;
+    }
+    
     float *pState = os->upState;                 /* State pointer */
     float *pCoeffs = os->pCoeffs;               /* Coefficient pointer */
     float *pStateCur;
@@ -237,6 +479,14 @@ float tOversampler_downsample(tOversampler *const osr, float* input)
     
     if (os->ratio == 1) return input[0];
     
+    if (os->type == OversamplerIIR)
+    {
+        float scratch[32]; // half the largest ratio
+        float output;
+        oversamplerIIRDownsample(os, input, &output, 1, scratch);
+        return output;
+    }
+    
     float *pState = os->downState;                 /* State pointer */
     float *pCoeffs = os->pCoeffs;               /* Coefficient pointer */
     float *pStateCur;                          /* Points to the current sample of the state */
@@ -333,6 +583,8 @@ void    tOversampler_setRatio       (tOversampler* const osr, int ratio)
         os->phaseLength = os->numTaps / os->ratio;
         os->pCoeffs = (float*) __leaf_tableref_firCoeffs[idx];
     }
+    os->numStages = (int)(log2f(os->ratio));
+    oversamplerUpdateLatency(os);
 }
 
 void    tOversampler_setQuality     (tOversampler* const osr, int quality)
@@ -350,12 +602,21 @@ void    tOversampler_setQuality     (tOversampler* const osr, int quality)
     os->numTaps = __leaf_tablesize_firNumTaps[idx];
     os->phaseLength = os->numTaps / os->ratio;
     os->pCoeffs = (float*) __leaf_tableref_firCoeffs[idx];
+    oversamplerUpdateLatency(os);
+}
+
+void tOversampler_setType(tOversampler* const osr, OversamplerType type)
+{
+    _tOversampler* os = *osr;
+    
+    os->type = type == OversamplerIIR ? OversamplerIIR : OversamplerFIR;
+    oversamplerUpdateLatency(os);
 }
 
 int tOversampler_getLatency(tOversampler* const osr)
 {
     _tOversampler* os = *osr;
-    return os->phaseLength;
+    return os->latency;
 }
 #endif // LEAF_INCLUDE_OVERSAMPLER_TABLES
 
@@ -399,6 +660,16 @@ void tLockhartWavefolder_initToPool (tLockhartWavefolder* const wf, tMempool* co
 
 	w->LambertThresh = 10e-12; //12  //was 8
 
+    // single precision copies for the fast path
+    w->fast = 0;
+    w->xf1 = 0.0f;
+    w->Ff1 = 0.0f;
+    w->lnd = (float)log(w->d);
+    w->bf = (float)w->b;
+    w->VTf = (float)w->VT;
+    w->af = (float)w->a;
+    w->half_af = (float)w->half_a;
+    w->longthingf = (float)w->longthing;
 
     w->w = 0.0f;
     w->expw = 0.0f;
@@ -617,6 +888,94 @@ float tLockhartWavefolder_tick(tLockhartWavefolder* const wf, float in)
     return out;
 }
 
+// Wright omega function, W(e^z), which is what the wavefolder needs from the
+// Lambert W since its argument is always an exponential. A W series for small
+// values and a fitted polynomial or the asymptotic form above give a first
+// guess good to 0.2%, and one Newton step brings it to about 2e-6.
+static inline float lockhartOmega(float z)
+{
+    float y;
+    if (z < -2.0f)
+    {
+        float u = expf(z);
+        y = u * (1.0f + u * (-1.0f + u * (1.5f + u * (-2.6666667f + u * (5.2083333f + u * -10.8f)))));
+        if (z < -12.0f) return y;
+    }
+    else if (z < 8.0f)
+    {
+        y = 0.5674258514f + z * (0.3619804574f + z * (0.07286275069f + z * (-0.001451920036f
+            + z * (-0.001251976297f + z * (0.0001913327747f + z * -0.000008964520316f)))));
+    }
+    else
+    {
+        float lz = logf(z);
+        y = z - lz + lz / z;
+    }
+    
+    // Newton step on y + ln(y) = z
+    return y * (1.0f + z - logf(y)) / (1.0f + y);
+}
+
+static inline float lockhartFastTick(_tLockhartWavefolder* w, float in)
+{
+    float L = lockhartOmega(w->lnd + w->bf * fabsf(in));
+    float F = w->longthingf * L * (L + 2.0f) - w->half_af * in * in;
+    float diff = in - w->xf1;
+    float out;
+    
+    if (fabsf(diff) < LOCKHART_FAST_THRESH)
+    {
+        float xn = 0.5f * (in + w->xf1);
+        float Lm = lockhartOmega(w->lnd + w->bf * fabsf(xn));
+        float l = (xn > 0.0f) - (xn < 0.0f);
+        out = l * w->VTf * Lm - w->af * xn;
+    }
+    else out = (F - w->Ff1) / diff;
+    
+    w->xf1 = in;
+    w->Ff1 = F;
+    return out;
+}
+
+float tLockhartWavefolder_tickFast(tLockhartWavefolder* const wf, float in)
+{
+    _tLockhartWavefolder* w = *wf;
+    return lockhartFastTick(w, in);
+}
+
+void tLockhartWavefolder_tickBlock(tLockhartWavefolder* const wf, float* input, float* output, int numSamples)
+{
+    _tLockhartWavefolder* w = *wf;
+    
+    if (w->fast)
+    {
+        for (int i = 0; i < numSamples; i++) output[i] = lockhartFastTick(w, input[i]);
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; i++) output[i] = tLockhartWavefolder_tick(wf, input[i]);
+    }
+}
+
+void tLockhartWavefolder_setFast(tLockhartWavefolder* const wf, int fast)
+{
+    _tLockhartWavefolder* w = *wf;
+    
+    // carry the antiderivative state across so switching doesn't click
+    if (fast && !w->fast)
+    {
+        w->xf1 = (float)w->xn1;
+        w->Ff1 = (float)w->Fn1;
+    }
+    else if (!fast && w->fast)
+    {
+        w->xn1 = w->xf1;
+        w->Ln1 = lockhartOmega(w->lnd + w->bf * fabsf(w->xf1));
+        w->Fn1 = (w->longthing * (w->Ln1 * (w->Ln1 + 2.0))) - (w->half_a * w->xn1 * w->xn1);
+    }
+    w->fast = fast ? 1 : 0;
+}
+
 //============================================================================================================
 // CRUSHER
 //============================================================================================================
@@ -705,3 +1064,362 @@ void    tCrusher_setSamplingRatio (tCrusher* const cr, float ratio)
     c->srr = ratio;
     tSampleReducer_setRatio(&c->sReducer, ratio);
 }
+
+#if LEAF_INCLUDE_ADAA_TABLES
+//============================================================================================================
+// ADAA Waveshaper
+//============================================================================================================
+// Antiderivative antialiasing after Parker, Zavalishin and Le Bivic, "Reducing the
+// aliasing of nonlinear waveshaping using continuous-time convolution" (DAFx 2016)
+// and Bilbao, Esqueda, Parker and Välimäki, "Antiderivative antialiasing for
+// memoryless nonlinearities" (IEEE SPL 2017).
+
+// Below this input difference the divided differences lose too much precision.
+// They are taken in double, as the antiderivatives are large next to their differences.
+#define ADAA_EPS 1.0e-5
+
+#define ADAA_TANH_RANGE 3.0f
+#define ADAA_SHAPER_RANGE 1.41421356f
+
+static double adaaHermiteF1(const float* f, const float* F1, double range, double x)
+{
+    int last = ADAA_TABLE_SIZE - 1;
+    if (x >= range) return F1[last] + f[last] * (x - range);
+    if (x <= -range) return F1[0] + f[0] * (x + range);
+    
+    double h = 2.0 * range / (double)last;
+    double pos = (x + range) / h;
+    int i = (int)pos;
+    if (i >= last) i = last - 1;
+    double t = pos - (double)i;
+    double t1 = 1.0 - t;
+    
+    // cubic Hermite with the curve itself as the slopes
+    return (1.0 + 2.0 * t) * t1 * t1 * F1[i] + t * t1 * t1 * h * f[i]
+    + t * t * (3.0 - 2.0 * t) * F1[i + 1] - t * t * t1 * h * f[i + 1];
+}
+
+// With slope set, returns the derivative of the interpolant instead, which second
+// order ADAA uses in place of F1 so that its fallbacks agree with its divided differences.
+static double adaaHermiteF2(const float* f, const float* F1, const double* F2, double range, double x, int slope)
+{
+    int last = ADAA_TABLE_SIZE - 1;
+    if (x >= range)
+    {
+        double d = x - range;
+        if (slope) return F1[last] + f[last] * d;
+        return F2[last] + F1[last] * d + 0.5 * f[last] * d * d;
+    }
+    if (x <= -range)
+    {
+        double d = x + range;
+        if (slope) return F1[0] + f[0] * d;
+        return F2[0] + F1[0] * d + 0.5 * f[0] * d * d;
+    }
+    
+    double h = 2.0 * range / (double)last;
+    double pos = (x + range) / h;
+    int i = (int)pos;
+    if (i >= last) i = last - 1;
+    double t = pos - (double)i;
+    double t2 = t * t;
+    double t3 = t2 * t;
+    double t4 = t3 * t;
+    double t5 = t4 * t;
+    
+    if (slope)
+    {
+        return ((-30.0 * t2 + 60.0 * t3 - 30.0 * t4) * F2[i]
+                + (1.0 - 18.0 * t2 + 32.0 * t3 - 15.0 * t4) * h * F1[i]
+                + 0.5 * (2.0 * t - 9.0 * t2 + 12.0 * t3 - 5.0 * t4) * h * h * f[i]
+                + (30.0 * t2 - 60.0 * t3 + 30.0 * t4) * F2[i + 1]
+                + (-12.0 * t2 + 28.0 * t3 - 15.0 * t4) * h * F1[i + 1]
+                + 0.5 * (3.0 * t2 - 8.0 * t3 + 5.0 * t4) * h * h * f[i + 1]) / h;
+    }
+    
+    // quintic Hermite with the first antiderivative and the curve as the first
+    // and second derivatives, so the second differences follow the curve closely
+    return (1.0 - 10.0 * t3 + 15.0 * t4 - 6.0 * t5) * F2[i]
+    + (t - 6.0 * t3 + 8.0 * t4 - 3.0 * t5) * h * F1[i]
+    + 0.5 * (t2 - 3.0 * t3 + 3.0 * t4 - t5) * h * h * f[i]
+    + (10.0 * t3 - 15.0 * t4 + 6.0 * t5) * F2[i + 1]
+    + (-4.0 * t3 + 7.0 * t4 - 3.0 * t5) * h * F1[i + 1]
+    + 0.5 * (t3 - 2.0 * t4 + t5) * h * h * f[i + 1];
+}
+
+static float adaaCurve(_tADAAShaper* s, float x)
+{
+    switch (s->type)
+    {
+        case ADAATanh: return LEAF_tanh(x);
+        case ADAASoftClip: return LEAF_softClip(x, s->thresh);
+        case ADAAShaper: return LEAF_shaper(x, 0.25f);
+        case ADAAQuantizer:
+            if (s->step <= 0.0000001f) return x;
+            return s->step * floorf(x / s->step + 0.5f);
+        default: return LEAF_clip(-1.0f, x, 1.0f);
+    }
+}
+
+static double adaaF1(_tADAAShaper* s, double x)
+{
+    switch (s->type)
+    {
+        case ADAATanh:
+        {
+            // LEAF_tanh's rational has a closed form, x^2/18 + 4/3 ln(1 + x^2/3),
+            // which the table's cubic Hermite misses by up to 9e-6 near the clip
+            double ax = fabs(x);
+            if (ax >= ADAA_TANH_RANGE) return ax - ADAA_TANH_RANGE + 0.5 + (4.0 / 3.0) * log(4.0);
+            double x2 = x * x;
+            return x2 / 18.0 + (4.0 / 3.0) * log1p(x2 / 3.0);
+        }
+        case ADAAShaper:
+            return adaaHermiteF1(__leaf_table_adaaShaper, __leaf_table_adaaShaperF1, ADAA_SHAPER_RANGE, x);
+        case ADAASoftClip:
+        {
+            // 1 - t(1-t)/|x| outside the threshold
+            double t = s->thresh;
+            double ax = fabs(x);
+            if (ax <= t) return 0.5 * x * x;
+            double F = 0.5 * t * t + (ax - t);
+            if (t > 0.0) F -= t * (1.0 - t) * log(ax / t);
+            return F;
+        }
+        case ADAAQuantizer:
+        {
+            double q = s->step;
+            if (q <= 0.0000001) return 0.5 * x * x;
+            // whole steps of the staircase up to x add up to a triangle number
+            double v = x / q + 0.5;
+            double n = floor(v);
+            double fr = v - n;
+            return q * q * (0.5 * n * (n - 1.0) + n * fr);
+        }
+        default:
+        {
+            double ax = fabs(x);
+            if (ax <= 1.0) return 0.5 * x * x;
+            return ax - 0.5;
+        }
+    }
+}
+
+static double adaaF2(_tADAAShaper* s, double x)
+{
+    switch (s->type)
+    {
+        case ADAATanh:
+            return adaaHermiteF2(__leaf_table_adaaTanh, __leaf_table_adaaTanhF1, __leaf_table_adaaTanhF2, ADAA_TANH_RANGE, x, 0);
+        case ADAAShaper:
+            return adaaHermiteF2(__leaf_table_adaaShaper, __leaf_table_adaaShaperF1, __leaf_table_adaaShaperF2, ADAA_SHAPER_RANGE, x, 0);
+        case ADAASoftClip:
+        {
+            double t = s->thresh;
+            double ax = fabs(x);
+            if (ax <= t) return x * x * x / 6.0;
+            double d = ax - t;
+            double F = t * t * t / 6.0 + 0.5 * t * t * d + 0.5 * d * d;
+            if (t > 0.0) F -= t * (1.0 - t) * (ax * log(ax / t) - d);
+            return x < 0.0 ? -F : F;
+        }
+        case ADAAQuantizer:
+        {
+            double q = s->step;
+            if (q <= 0.0000001) return x * x * x / 6.0;
+            double v = x / q + 0.5;
+            double n = floor(v);
+            double fr = v - n;
+            return q * q * q * ((n - 1.0) * n * (2.0 * n - 1.0) / 12.0
+                                + 0.5 * n * (n - 1.0) * fr + 0.5 * n * fr * fr);
+        }
+        default:
+        {
+            double ax = fabs(x);
+            if (ax <= 1.0) return x * x * x / 6.0;
+            double F = 0.5 * ax * ax - 0.5 * ax + 1.0 / 6.0;
+            return x < 0.0 ? -F : F;
+        }
+    }
+}
+
+// the derivative of F2 as computed, which only differs from F1 for the tables
+static double adaaF2Slope(_tADAAShaper* s, double x)
+{
+    switch (s->type)
+    {
+        case ADAATanh:
+            return adaaHermiteF2(__leaf_table_adaaTanh, __leaf_table_adaaTanhF1, __leaf_table_adaaTanhF2, ADAA_TANH_RANGE, x, 1);
+        case ADAAShaper:
+            return adaaHermiteF2(__leaf_table_adaaShaper, __leaf_table_adaaShaperF1, __leaf_table_adaaShaperF2, ADAA_SHAPER_RANGE, x, 1);
+        default:
+            return adaaF1(s, x);
+    }
+}
+
+// divided difference of F2, falling back to its slope at the midpoint
+static double adaaD(_tADAAShaper* s, double a, double b, double F2a, double F2b)
+{
+    double d = a - b;
+    if (fabs(d) < ADAA_EPS) return adaaF2Slope(s, 0.5 * (a + b));
+    return (F2a - F2b) / d;
+}
+
+static void adaaRefresh(_tADAAShaper* s)
+{
+    s->F1x1 = adaaF1(s, s->x1);
+    s->F2x1 = adaaF2(s, s->x1);
+    s->D1 = adaaD(s, s->x1, s->x2, s->F2x1, adaaF2(s, s->x2));
+}
+
+static inline float adaaTick1(_tADAAShaper* s, float x)
+{
+    double F1 = adaaF1(s, x);
+    double d = (double)x - (double)s->x1;
+    float y;
+    
+    if (fabs(d) < ADAA_EPS) y = adaaCurve(s, 0.5f * (x + s->x1));
+    else y = (float)((F1 - s->F1x1) / d);
+    
+    s->x1 = x;
+    s->F1x1 = F1;
+    return y;
+}
+
+static inline float adaaTick2(_tADAAShaper* s, float x)
+{
+    double F2 = adaaF2(s, x);
+    double D0 = adaaD(s, x, s->x1, F2, s->F2x1);
+    double d = (double)x - (double)s->x2;
+    double y;
+    
+    if (fabs(d) >= ADAA_EPS) y = 2.0 * (D0 - s->D1) / d;
+    else
+    {
+        // x and x2 coincide, so the kernel sits on the segment from their midpoint to x1
+        double mid = 0.5 * ((double)x + (double)s->x2);
+        double delta = mid - (double)s->x1;
+        if (fabs(delta) < ADAA_EPS) y = adaaCurve(s, (float)(0.5 * (mid + s->x1)));
+        else y = 2.0 / delta * (adaaF2Slope(s, mid) + (s->F2x1 - adaaF2(s, mid)) / delta);
+    }
+    
+    s->x2 = s->x1;
+    s->x1 = x;
+    s->F2x1 = F2;
+    s->D1 = D0;
+    return (float)y;
+}
+
+void tADAAShaper_init (tADAAShaper* const sh, ADAAShaperType type, int order, LEAF* const leaf)
+{
+    tADAAShaper_initToPool(sh, type, order, &leaf->mempool);
+}
+
+void tADAAShaper_initToPool (tADAAShaper* const sh, ADAAShaperType type, int order, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tADAAShaper* s = *sh = (_tADAAShaper*) mpool_alloc(sizeof(_tADAAShaper), m);
+    s->mempool = m;
+    
+    s->type = (type >= ADAAHardClip && type < ADAAShaperTypeNil) ? type : ADAAHardClip;
+    s->order = order > 1 ? 2 : 1;
+    s->thresh = 0.5f;
+    s->drive = 0.25f;
+    s->gain = s->type == ADAAShaper ? s->drive + 0.75f : 1.0f;
+    s->offset = 0.0f;
+    s->slope = 1.0f;
+    s->step = 0.125f;
+    s->x1 = 0.0f;
+    s->x2 = 0.0f;
+    adaaRefresh(s);
+}
+
+void tADAAShaper_free (tADAAShaper* const sh)
+{
+    _tADAAShaper* s = *sh;
+    
+    mpool_free((char*)s, s->mempool);
+}
+
+float tADAAShaper_tick (tADAAShaper* const sh, float input)
+{
+    _tADAAShaper* s = *sh;
+    
+    float x = input;
+    if (s->type == ADAAReedTable) x = s->offset + s->slope * input;
+    
+    float y = s->order == 2 ? adaaTick2(s, x) : adaaTick1(s, x);
+    return y * s->gain;
+}
+
+void tADAAShaper_tickBlock (tADAAShaper* const sh, float* input, float* output, int numSamples)
+{
+    _tADAAShaper* s = *sh;
+    
+    float offset = s->type == ADAAReedTable ? s->offset : 0.0f;
+    float slope = s->type == ADAAReedTable ? s->slope : 1.0f;
+    float gain = s->gain;
+    
+    if (s->order == 2)
+    {
+        for (int i = 0; i < numSamples; i++)
+            output[i] = adaaTick2(s, offset + slope * input[i]) * gain;
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; i++)
+            output[i] = adaaTick1(s, offset + slope * input[i]) * gain;
+    }
+}
+
+void tADAAShaper_setType (tADAAShaper* const sh, ADAAShaperType type)
+{
+    _tADAAShaper* s = *sh;
+    
+    if (type < ADAAHardClip || type >= ADAAShaperTypeNil) return;
+    s->type = type;
+    s->gain = type == ADAAShaper ? s->drive + 0.75f : 1.0f;
+    adaaRefresh(s);
+}
+
+void tADAAShaper_setOrder (tADAAShaper* const sh, int order)
+{
+    _tADAAShaper* s = *sh;
+    
+    s->order = order > 1 ? 2 : 1;
+    adaaRefresh(s);
+}
+
+void tADAAShaper_setThreshold (tADAAShaper* const sh, float thresh)
+{
+    _tADAAShaper* s = *sh;
+    
+    s->thresh = LEAF_clip(0.0f, thresh, 1.0f);
+    if (s->type == ADAASoftClip) adaaRefresh(s);
+}
+
+void tADAAShaper_setDrive (tADAAShaper* const sh, float drive)
+{
+    _tADAAShaper* s = *sh;
+    
+    // the drive of LEAF_shaper only scales its output, so the tables stay the same
+    s->drive = drive;
+    if (s->type == ADAAShaper) s->gain = drive + 0.75f;
+}
+
+void tADAAShaper_setReedTable (tADAAShaper* const sh, float offset, float slope)
+{
+    _tADAAShaper* s = *sh;
+    
+    s->offset = offset;
+    s->slope = slope;
+}
+
+void tADAAShaper_setStep (tADAAShaper* const sh, float step)
+{
+    _tADAAShaper* s = *sh;
+    
+    s->step = fabsf(step);
+    if (s->type == ADAAQuantizer) adaaRefresh(s);
+}
+#endif // LEAF_INCLUDE_ADAA_TABLES
@@ -92,30 +92,19 @@ float tCompressor_tick(tCompressor* const comp, float in)
     
     overshoot = in_db - c->T;
     
-    /*
-    if (overshoot <= -(c->W * 0.5f))
+    // with no knee the middle range is empty and this is a hard knee
+    float halfW = c->W * 0.5f;
+    if (overshoot <= -halfW)
     {
         out_db = in_db;
         c->isActive = 0;
     }
-
-    else if ((overshoot > -(c->W * 0.5f)) && (overshoot < (c->W * 0.5f)))
+    else if (overshoot < halfW)
     {
-        float squareit = (overshoot + c->W*0.5f);
-        out_db = in_db + slope * ((squareit * squareit) / (2.0f * c->W)); // .^ 2 ???
+        float squareit = (overshoot + halfW);
+        out_db = in_db + slope * ((squareit * squareit) / (2.0f * c->W));
         c->isActive = 1;
     }
-    else if (overshoot >= (c->W * 0.5f))
-    {
-        out_db = in_db + slope * overshoot;
-        c->isActive = 1;
-    }
-    */
-    if (overshoot <= 0.0f)
-    {
-        out_db = in_db;
-        c->isActive = 0;
-    }
     else
     {
         out_db = in_db + slope * overshoot;
@@ -164,6 +153,413 @@ void tCompressor_setParams(tCompressor* const comp, float thresh, float ratio, f
     c->tauRelease = expf(-1.0f/(0.001f * release * c->sampleRate));
 }
 
+// log2, exp2, min and max with no calls or branches, so the block loops
+// vectorize. The log is the cubic from log2f_approx() and the exp is
+// fastexp2f(), good to about 0.01 dB and 0.002 dB.
+static inline float compressorMax(float a, float b)
+{
+    return 0.5f * (a + b + fabsf(a - b));
+}
+
+static inline float compressorMin(float a, float b)
+{
+    return 0.5f * (a + b - fabsf(a - b));
+}
+
+static inline float compressorLog2(float x)
+{
+    union { float f; int32_t i; } bits = { x };
+    float e = (float) ((bits.i >> 23) & 0xFF) - 126.0f;
+    bits.i = (bits.i & 0x007FFFFF) | 0x3F000000; // mantissa in [0.5, 1)
+    float f = bits.f;
+    return ((1.23149591368684f * f - 4.11852516267426f) * f + 6.02197014179219f) * f - 3.13396450166353f + e;
+}
+
+static inline float compressorExp2(float x)
+{
+    x = compressorMin(compressorMax(x, -126.0f), 126.0f);
+    int32_t i = (int32_t) (x + 4096.0f) - 4096;
+    float f = x - (float) i;
+    union { int32_t i; float f; } bits = { (i + 127) << 23 };
+    return (1.0f + f * (0.69303212081966f + f * (0.24137976293709f + f * (0.05203236900844f + f * 0.01355574723481f)))) * bits.f;
+}
+
+// Detector levels in, gain computer output (the dB of gain reduction) out.
+static void compressorGainCurve(float T, float R, float W, float* buff, int n)
+{
+    float slope = 1.0f - (1.0f/R);
+    
+    if (W > 0.0f)
+    {
+        // the knee's quadratic, clamped, plus whatever is above the knee
+        float halfW = W * 0.5f;
+        float invTwoW = 1.0f / (2.0f * W);
+        for (int i = 0; i < n; i++)
+        {
+            float in_db = 6.02059991f * compressorLog2(buff[i]);
+            in_db = compressorMin(compressorMax(in_db, -90.0f), 0.0f);
+            float overshoot = in_db - T;
+            float squareit = compressorMin(compressorMax(overshoot + halfW, 0.0f), W);
+            buff[i] = slope * (squareit * squareit * invTwoW + compressorMax(overshoot - halfW, 0.0f));
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+        {
+            float in_db = 6.02059991f * compressorLog2(buff[i]);
+            in_db = compressorMin(compressorMax(in_db, -90.0f), 0.0f);
+            buff[i] = slope * compressorMax(in_db - T, 0.0f);
+        }
+    }
+}
+
+// Gain reduction in, linear gain out. The smoothing is the only serial part.
+static void compressorSmooth(_tCompressor* c, float* buff, int n)
+{
+    float x = c->x_T[0];
+    float y = c->y_T[0];
+    float yPrev = c->y_T[1];
+    float a = c->tauAttack;
+    float r = c->tauRelease;
+    
+    for (int i = 0; i < n; i++)
+    {
+        x = buff[i];
+        yPrev = y;
+        if (x > y)  y = a * y + (1.0f - a) * x;
+        else        y = r * y + (1.0f - r) * x;
+        buff[i] = y;
+    }
+    
+    c->x_T[0] = x;
+    c->y_T[0] = y;
+    c->y_T[1] = yPrev;
+    c->isActive = x > 0.0f;
+    
+    float M = c->M;
+    for (int i = 0; i < n; i++) buff[i] = compressorExp2((M - buff[i]) * 0.166096404744368f);
+}
+
+void tCompressor_tickBlock(tCompressor* const comp, float* input, float* output, int numSamples)
+{
+    _tCompressor* c = *comp;
+    float buff[COMPRESSOR_BLOCK_SIZE];
+    
+    for (int offset = 0; offset < numSamples; offset += COMPRESSOR_BLOCK_SIZE)
+    {
+        int n = numSamples - offset;
+        if (n > COMPRESSOR_BLOCK_SIZE) n = COMPRESSOR_BLOCK_SIZE;
+        float* in = &input[offset];
+        float* out = &output[offset];
+        
+        for (int i = 0; i < n; i++) buff[i] = fabsf(in[i]);
+        compressorGainCurve(c->T, c->R, c->W, buff, n);
+        compressorSmooth(c, buff, n);
+        for (int i = 0; i < n; i++) out[i] = buff[i] * in[i];
+    }
+}
+
+void tCompressor_tickBlockLinked(tCompressor* const comp, float** input, float** output, int numChannels, int numSamples)
+{
+    _tCompressor* c = *comp;
+    float buff[COMPRESSOR_BLOCK_SIZE];
+    
+    for (int offset = 0; offset < numSamples; offset += COMPRESSOR_BLOCK_SIZE)
+    {
+        int n = numSamples - offset;
+        if (n > COMPRESSOR_BLOCK_SIZE) n = COMPRESSOR_BLOCK_SIZE;
+        
+        // detect on the loudest channel so the image doesn't shift
+        for (int i = 0; i < n; i++) buff[i] = 0.0f;
+        for (int ch = 0; ch < numChannels; ch++)
+        {
+            float* in = &input[ch][offset];
+            for (int i = 0; i < n; i++)
+            {
+                float level = fabsf(in[i]);
+                buff[i] = (level > buff[i]) ? level : buff[i];
+            }
+        }
+        compressorGainCurve(c->T, c->R, c->W, buff, n);
+        compressorSmooth(c, buff, n);
+        for (int ch = 0; ch < numChannels; ch++)
+        {
+            float* in = &input[ch][offset];
+            float* out = &output[ch][offset];
+            for (int i = 0; i < n; i++) out[i] = buff[i] * in[i];
+        }
+    }
+}
+
+// ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ Multiband Compressor ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ //
+
+void tMultibandCompressor_init (tMultibandCompressor* const comp, int numBands, LEAF* const leaf)
+{
+    tMultibandCompressor_initToPool(comp, numBands, &leaf->mempool);
+}
+
+void tMultibandCompressor_initToPool (tMultibandCompressor* const comp, int numBands, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tMultibandCompressor* c = *comp = (_tMultibandCompressor*) mpool_alloc(sizeof(_tMultibandCompressor), m);
+    c->mempool = m;
+    LEAF* leaf = c->mempool->leaf;
+    c->sampleRate = leaf->sampleRate;
+    c->invSampleRate = leaf->invSampleRate;
+    
+    if (numBands < 1) numBands = 1;
+    c->numBands = numBands;
+    int numCrossovers = numBands - 1;
+    
+    // three filters per crossover and an allpass for every band below it
+    c->numFilters = 3 * numCrossovers + (numCrossovers * (numCrossovers - 1)) / 2;
+    c->ic1eq = (float*) mpool_alloc(sizeof(float) * (c->numFilters * 2 + 1), m);
+    c->ic2eq = &c->ic1eq[c->numFilters];
+    for (int i = 0; i < c->numFilters * 2; i++) c->ic1eq[i] = 0.0f;
+    
+    c->freq = (float*) mpool_alloc(sizeof(float) * (numCrossovers * 4 + 1), m);
+    c->a1 = &c->freq[numCrossovers];
+    c->a2 = &c->a1[numCrossovers];
+    c->a3 = &c->a2[numCrossovers];
+    
+    // the per band arrays are padded out to a whole number of lanes
+    int numLanes = ((numBands + MULTIBAND_LANES - 1) / MULTIBAND_LANES) * MULTIBAND_LANES;
+    c->T = (float*) mpool_alloc(sizeof(float) * numLanes * 8, m);
+    for (int i = 0; i < numLanes * 8; i++) c->T[i] = 0.0f;
+    c->R = &c->T[numLanes];
+    c->W = &c->R[numLanes];
+    c->M = &c->W[numLanes];
+    c->tauAttack = &c->M[numLanes];
+    c->tauRelease = &c->tauAttack[numLanes];
+    c->y_T = &c->tauRelease[numLanes];
+    c->gain = &c->y_T[numLanes];
+    
+    c->bands = (float*) mpool_alloc(sizeof(float) * (numBands + numLanes + 1) * MULTIBAND_BLOCK_SIZE, m);
+    c->gains = &c->bands[numBands * MULTIBAND_BLOCK_SIZE];
+    c->rest = &c->gains[numLanes * MULTIBAND_BLOCK_SIZE];
+    for (int i = 0; i < numLanes * MULTIBAND_BLOCK_SIZE; i++) c->gains[i] = 0.0f;
+    
+    // crossovers spaced evenly in log frequency between 100 Hz and 8 kHz
+    for (int j = 0; j < numCrossovers; j++)
+    {
+        float position = (numCrossovers > 1) ? (float) j / (numCrossovers - 1) : 0.5f;
+        tMultibandCompressor_setCrossover(comp, j, 100.0f * powf(80.0f, position));
+    }
+    for (int b = 0; b < numBands; b++)
+    {
+        tMultibandCompressor_setBandParams(comp, b, 0.0f, 1.0f, 0.0f, 0.0f, 5.0f, 100.0f);
+        c->y_T[b] = 0.0f;
+        c->gain[b] = 1.0f;
+    }
+}
+
+void tMultibandCompressor_free (tMultibandCompressor* const comp)
+{
+    _tMultibandCompressor* c = *comp;
+    
+    mpool_free((char*)c->bands, c->mempool);
+    mpool_free((char*)c->T, c->mempool);
+    mpool_free((char*)c->freq, c->mempool);
+    mpool_free((char*)c->ic1eq, c->mempool);
+    mpool_free((char*)c, c->mempool);
+}
+
+// Split the block into bands with Linkwitz-Riley crossovers, each a pair of
+// cascaded Butterworth state variable filters. The bands below a crossover go
+// through the allpass that crossover sums to, so the bands stay in phase.
+static void multibandSplit(_tMultibandCompressor* c, float* input, int n)
+{
+    float k = LEAF_SQRT2;
+    float* rest = c->rest;
+    int ap = 3 * (c->numBands - 1);
+    
+    for (int i = 0; i < n; i++) rest[i] = input[i];
+    
+    for (int j = 0; j < c->numBands - 1; j++)
+    {
+        float a1 = c->a1[j], a2 = c->a2[j], a3 = c->a3[j];
+        float* low = &c->bands[j * MULTIBAND_BLOCK_SIZE];
+        
+        // keep the state in registers for the block
+        int s = 3 * j;
+        float s1 = c->ic1eq[s], s2 = c->ic2eq[s];
+        float l1 = c->ic1eq[s+1], l2 = c->ic2eq[s+1];
+        float h1 = c->ic1eq[s+2], h2 = c->ic2eq[s+2];
+        float* p1 = &c->ic1eq[ap];
+        float* p2 = &c->ic2eq[ap];
+        
+        for (int i = 0; i < n; i++)
+        {
+            float v0 = rest[i];
+            float v1, v2, v3, lp, hp;
+            
+            v3 = v0 - s2;
+            v1 = (a1 * s1) + (a2 * v3);
+            v2 = s2 + (a2 * s1) + (a3 * v3);
+            s1 = (2.0f * v1) - s1;
+            s2 = (2.0f * v2) - s2;
+            lp = v2;
+            hp = v0 - (k * v1) - v2;
+            
+            v3 = lp - l2;
+            v1 = (a1 * l1) + (a2 * v3);
+            v2 = l2 + (a2 * l1) + (a3 * v3);
+            l1 = (2.0f * v1) - l1;
+            l2 = (2.0f * v2) - l2;
+            low[i] = v2;
+            
+            v3 = hp - h2;
+            v1 = (a1 * h1) + (a2 * v3);
+            v2 = h2 + (a2 * h1) + (a3 * v3);
+            h1 = (2.0f * v1) - h1;
+            h2 = (2.0f * v2) - h2;
+            rest[i] = hp - (k * v1) - v2;
+            
+            // the allpasses run in the same pass so their recursions overlap
+            for (int b = 0; b < j; b++)
+            {
+                float* band = &c->bands[b * MULTIBAND_BLOCK_SIZE];
+                v0 = band[i];
+                v3 = v0 - p2[b];
+                v1 = (a1 * p1[b]) + (a2 * v3);
+                v2 = p2[b] + (a2 * p1[b]) + (a3 * v3);
+                p1[b] = (2.0f * v1) - p1[b];
+                p2[b] = (2.0f * v2) - p2[b];
+                band[i] = v0 - (2.0f * k * v1);
+            }
+        }
+        
+        c->ic1eq[s] = s1; c->ic2eq[s] = s2;
+        c->ic1eq[s+1] = l1; c->ic2eq[s+1] = l2;
+        c->ic1eq[s+2] = h1; c->ic2eq[s+2] = h2;
+        ap += j;
+    }
+    
+    float* top = &c->bands[(c->numBands - 1) * MULTIBAND_BLOCK_SIZE];
+    for (int i = 0; i < n; i++) top[i] = rest[i];
+}
+
+void tMultibandCompressor_tickBlock (tMultibandCompressor* const comp, float* input, float* output, int numSamples)
+{
+    _tMultibandCompressor* c = *comp;
+    int numBands = c->numBands;
+    
+    for (int offset = 0; offset < numSamples; offset += MULTIBAND_BLOCK_SIZE)
+    {
+        int n = numSamples - offset;
+        if (n > MULTIBAND_BLOCK_SIZE) n = MULTIBAND_BLOCK_SIZE;
+        
+        multibandSplit(c, &input[offset], n);
+        
+        for (int b = 0; b < numBands; b++)
+        {
+            float* band = &c->bands[b * MULTIBAND_BLOCK_SIZE];
+            float* gains = &c->gains[b * MULTIBAND_BLOCK_SIZE];
+            for (int i = 0; i < n; i++) gains[i] = fabsf(band[i]);
+            compressorGainCurve(c->T[b], c->R[b], c->W[b], gains, n);
+        }
+        
+        // the smoothers run with the bands side by side, MULTIBAND_LANES at a
+        // time, with the state held in locals so it stays in registers
+        for (int b0 = 0; b0 < numBands; b0 += MULTIBAND_LANES)
+        {
+            float y[MULTIBAND_LANES], att[MULTIBAND_LANES], rel[MULTIBAND_LANES];
+            float* g = &c->gains[b0 * MULTIBAND_BLOCK_SIZE];
+            for (int l = 0; l < MULTIBAND_LANES; l++)
+            {
+                y[l] = c->y_T[b0 + l];
+                att[l] = c->tauAttack[b0 + l];
+                rel[l] = c->tauRelease[b0 + l];
+            }
+            for (int i = 0; i < n; i++)
+            {
+                for (int l = 0; l < MULTIBAND_LANES; l++)
+                {
+                    float x = g[l * MULTIBAND_BLOCK_SIZE + i];
+                    float tau = (x > y[l]) ? att[l] : rel[l];
+                    y[l] = x + tau * (y[l] - x);
+                    g[l * MULTIBAND_BLOCK_SIZE + i] = y[l];
+                }
+            }
+            for (int l = 0; l < MULTIBAND_LANES; l++) c->y_T[b0 + l] = y[l];
+        }
+        
+        float* out = &output[offset];
+        for (int i = 0; i < n; i++) out[i] = 0.0f;
+        for (int b = 0; b < numBands; b++)
+        {
+            float* band = &c->bands[b * MULTIBAND_BLOCK_SIZE];
+            float* gains = &c->gains[b * MULTIBAND_BLOCK_SIZE];
+            float M = c->M[b];
+            for (int i = 0; i < n; i++)
+            {
+                gains[i] = compressorExp2((M - gains[i]) * 0.166096404744368f);
+                out[i] += gains[i] * band[i];
+            }
+            c->gain[b] = gains[n-1];
+        }
+    }
+}
+
+float tMultibandCompressor_tick (tMultibandCompressor* const comp, float input)
+{
+    float output;
+    tMultibandCompressor_tickBlock(comp, &input, &output, 1);
+    return output;
+}
+
+void tMultibandCompressor_setCrossover (tMultibandCompressor* const comp, int crossover, float freq)
+{
+    _tMultibandCompressor* c = *comp;
+    
+    if (crossover < 0 || crossover >= c->numBands - 1) return;
+    
+    freq = LEAF_clip(10.0f, freq, c->sampleRate * 0.45f);
+    c->freq[crossover] = freq;
+    float g = tanf(PI * freq * c->invSampleRate);
+    c->a1[crossover] = 1.0f/(1.0f + g * (g + LEAF_SQRT2));
+    c->a2[crossover] = g * c->a1[crossover];
+    c->a3[crossover] = g * c->a2[crossover];
+}
+
+void tMultibandCompressor_setBandParams (tMultibandCompressor* const comp, int band, float thresh, float ratio, float knee, float makeup, float attack, float release)
+{
+    _tMultibandCompressor* c = *comp;
+    
+    if (band < 0 || band >= c->numBands) return;
+    
+    c->T[band] = thresh;
+    c->R[band] = ratio;
+    c->W[band] = knee;
+    c->M[band] = makeup;
+    c->tauAttack[band] = expf(-1.0f/(0.001f * attack * c->sampleRate));
+    c->tauRelease[band] = expf(-1.0f/(0.001f * release * c->sampleRate));
+}
+
+float tMultibandCompressor_getGain (tMultibandCompressor* const comp, int band)
+{
+    _tMultibandCompressor* c = *comp;
+    return c->gain[band];
+}
+
+void tMultibandCompressor_setSampleRate (tMultibandCompressor* const comp, float sr)
+{
+    _tMultibandCompressor* c = *comp;
+    
+    // keep the time constants the same in milliseconds
+    float ratio = c->sampleRate / sr;
+    for (int b = 0; b < c->numBands; b++)
+    {
+        c->tauAttack[b] = powf(c->tauAttack[b], ratio);
+        c->tauRelease[b] = powf(c->tauRelease[b], ratio);
+    }
+    
+    c->sampleRate = sr;
+    c->invSampleRate = 1.0f / sr;
+    for (int j = 0; j < c->numBands - 1; j++) tMultibandCompressor_setCrossover(comp, j, c->freq[j]);
+}
+
 /* Feedback Leveler */
 
 void tFeedbackLeveler_init (tFeedbackLeveler* const fb, float targetLevel, float factor, float strength, int mode, LEAF* const leaf)
@@ -288,3 +684,329 @@ void tThreshold_setHigh(tThreshold* const th, float high)
 
     t->highThresh = high;
 }
+
+// ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ Limiter ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ //
+
+static void limiterReset(_tLimiter* l)
+{
+    int cap = l->maxWindow;
+    
+    for (int g = 0; g < l->numChannels; g++)
+    {
+        l->dequeHead[g] = 0;
+        l->dequeSize[g] = 0;
+        for (int i = 0; i < cap; i++) l->history[g * cap + i] = LIMITER_UNITY;
+        l->sum[g] = (uint64_t) LIMITER_UNITY * l->window;
+        l->held[g] = 1.0f;
+        l->gain[g] = 1.0f;
+        l->peak[g] = 0.0f;
+    }
+    for (int i = 0; i < l->numChannels * LIMITER_TRUE_PEAK_TAPS; i++) l->recent[i] = 0.0f;
+    for (int c = 0; c < l->numChannels; c++) l->lastSegment[c] = 0.0f;
+    l->pos = 0;
+}
+
+static void limiterUpdateDelays(_tLimiter* l)
+{
+    for (int c = 0; c < l->numChannels; c++)
+        tDelay_setDelay(&l->delays[c], tLimiter_getLatency(&l));
+}
+
+void tLimiter_init (tLimiter* const lim, int numChannels, float maxLookahead, LEAF* const leaf)
+{
+    tLimiter_initToPool(lim, numChannels, maxLookahead, &leaf->mempool);
+}
+
+void tLimiter_initToPool (tLimiter* const lim, int numChannels, float maxLookahead, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tLimiter* l = *lim = (_tLimiter*) mpool_alloc(sizeof(_tLimiter), m);
+    l->mempool = m;
+    LEAF* leaf = l->mempool->leaf;
+    l->sampleRate = leaf->sampleRate;
+    
+    if (numChannels < 1) numChannels = 1;
+    l->numChannels = numChannels;
+    l->numGroups = 1;
+    l->link = 1;
+    l->truePeak = 0;
+    l->count = 0;
+    
+    l->maxWindow = (int) (0.001f * maxLookahead * l->sampleRate) + 1;
+    l->window = l->maxWindow;
+    l->invWindow = 1.0f / (l->window * (float) LIMITER_UNITY);
+    l->lookaheadMs = maxLookahead;
+    int cap = l->maxWindow;
+    
+    l->delays = (tDelay*) mpool_alloc(sizeof(tDelay) * numChannels, m);
+    for (int c = 0; c < numChannels; c++)
+    {
+        tDelay_initToPool(&l->delays[c], 0, cap + LIMITER_TRUE_PEAK_TAPS / 2, mp);
+        tDelay_clear(&l->delays[c]);
+    }
+    
+    l->dequeIndex = (uint32_t*) mpool_alloc(sizeof(uint32_t) * numChannels * cap, m);
+    l->dequeValue = (float*) mpool_alloc(sizeof(float) * numChannels * cap, m);
+    l->dequeHead = (int*) mpool_alloc(sizeof(int) * numChannels, m);
+    l->dequeSize = (int*) mpool_alloc(sizeof(int) * numChannels, m);
+    l->history = (uint32_t*) mpool_alloc(sizeof(uint32_t) * numChannels * cap, m);
+    l->sum = (uint64_t*) mpool_alloc(sizeof(uint64_t) * numChannels, m);
+    l->held = (float*) mpool_alloc(sizeof(float) * numChannels, m);
+    l->gain = (float*) mpool_alloc(sizeof(float) * numChannels, m);
+    l->peak = (float*) mpool_alloc(sizeof(float) * numChannels, m);
+    l->gainBlock = (float*) mpool_alloc(sizeof(float) * numChannels * LIMITER_BLOCK_SIZE, m);
+    l->recent = (float*) mpool_alloc(sizeof(float) * numChannels * LIMITER_TRUE_PEAK_TAPS, m);
+    l->lastSegment = (float*) mpool_alloc(sizeof(float) * numChannels, m);
+    
+    // Blackman windowed sinc interpolators for the points between samples
+    for (int p = 1; p < LIMITER_TRUE_PEAK_PHASES; p++)
+    {
+        float* h = &l->coeffs[(p - 1) * LIMITER_TRUE_PEAK_TAPS];
+        float total = 0.0f;
+        for (int k = 0; k < LIMITER_TRUE_PEAK_TAPS; k++)
+        {
+            float t = (float) (k - (LIMITER_TRUE_PEAK_TAPS / 2 - 1)) - (float) p / LIMITER_TRUE_PEAK_PHASES;
+            float w = PI * t / (LIMITER_TRUE_PEAK_TAPS / 2);
+            h[k] = (sinf(PI * t) / (PI * t)) * (0.42f + 0.5f * cosf(w) + 0.08f * cosf(2.0f * w));
+            total += h[k];
+        }
+        for (int k = 0; k < LIMITER_TRUE_PEAK_TAPS; k++) h[k] /= total;
+    }
+    
+    l->ceiling = 1.0f;
+    tLimiter_setRelease(lim, 50.0f);
+    limiterUpdateDelays(l);
+    limiterReset(l);
+}
+
+void tLimiter_free (tLimiter* const lim)
+{
+    _tLimiter* l = *lim;
+    
+    for (int c = 0; c < l->numChannels; c++) tDelay_free(&l->delays[c]);
+    mpool_free((char*)l->delays, l->mempool);
+    mpool_free((char*)l->dequeIndex, l->mempool);
+    mpool_free((char*)l->dequeValue, l->mempool);
+    mpool_free((char*)l->dequeHead, l->mempool);
+    mpool_free((char*)l->dequeSize, l->mempool);
+    mpool_free((char*)l->history, l->mempool);
+    mpool_free((char*)l->sum, l->mempool);
+    mpool_free((char*)l->held, l->mempool);
+    mpool_free((char*)l->gain, l->mempool);
+    mpool_free((char*)l->peak, l->mempool);
+    mpool_free((char*)l->gainBlock, l->mempool);
+    mpool_free((char*)l->recent, l->mempool);
+    mpool_free((char*)l->lastSegment, l->mempool);
+    mpool_free((char*)l, l->mempool);
+}
+
+// Fold a channel's input into its group's peak for this frame.
+static inline void limiterPeak(_tLimiter* l, int c, float in)
+{
+    float peak;
+    
+    if (l->truePeak)
+    {
+        float* r = &l->recent[c * LIMITER_TRUE_PEAK_TAPS];
+        for (int k = 0; k < LIMITER_TRUE_PEAK_TAPS - 1; k++) r[k] = r[k + 1];
+        r[LIMITER_TRUE_PEAK_TAPS - 1] = in;
+        
+        // the gain for a sample has to cover the points on both sides of it
+        float segment = fabsf(r[LIMITER_TRUE_PEAK_TAPS / 2 - 1]);
+        for (int p = 0; p < LIMITER_TRUE_PEAK_PHASES - 1; p++)
+        {
+            float* h = &l->coeffs[p * LIMITER_TRUE_PEAK_TAPS];
+            float y = 0.0f;
+            for (int k = 0; k < LIMITER_TRUE_PEAK_TAPS; k++) y += h[k] * r[k];
+            y = fabsf(y);
+            if (y > segment) segment = y;
+        }
+        peak = (segment > l->lastSegment[c]) ? segment : l->lastSegment[c];
+        l->lastSegment[c] = segment;
+    }
+    else peak = fabsf(in);
+    
+    int g = l->link ? 0 : c;
+    if (peak > l->peak[g]) l->peak[g] = peak;
+}
+
+// Turn a group's peak into this frame's gain.
+static inline float limiterGain(_tLimiter* l, int g)
+{
+    int cap = l->maxWindow;
+    uint32_t* idx = &l->dequeIndex[g * cap];
+    float* val = &l->dequeValue[g * cap];
+    int head = l->dequeHead[g];
+    int size = l->dequeSize[g];
+    float peak = l->peak[g];
+    l->peak[g] = 0.0f;
+    
+    // sliding maximum: the front leaves once it is out of the window, and
+    // anything the new peak is louder than can never be the maximum again
+    if (size > 0 && l->count - idx[head] >= (uint32_t) l->window)
+    {
+        if (++head == cap) head = 0;
+        size--;
+    }
+    while (size > 0)
+    {
+        int back = head + size - 1;
+        if (back >= cap) back -= cap;
+        if (val[back] > peak) break;
+        size--;
+    }
+    int back = head + size;
+    if (back >= cap) back -= cap;
+    idx[back] = l->count;
+    val[back] = peak;
+    l->dequeHead[g] = head;
+    l->dequeSize[g] = size + 1;
+    
+    float max = val[head];
+    float target = (max > l->ceiling) ? l->ceiling / max : 1.0f;
+    
+    // instant attack and exponential release, never above the target
+    float r = l->held[g];
+    if (target < r) r = target;
+    else r = target + l->releaseCoeff * (r - target);
+    l->held[g] = r;
+    
+    // every gain in the average was computed with the delayed sample in view,
+    // so the average is at most what that sample needs. The gains are summed
+    // in fixed point, rounded down, so the running sum is exact and can't
+    // drift above that.
+    uint32_t* h = &l->history[g * cap];
+    uint32_t q = (uint32_t) (r * (float) LIMITER_UNITY);
+    int old = l->pos - l->window;
+    if (old < 0) old += cap;
+    l->sum[g] += q;
+    l->sum[g] -= h[old];
+    h[l->pos] = q;
+    
+    return (float) l->sum[g] * l->invWindow;
+}
+
+static inline void limiterAdvance(_tLimiter* l)
+{
+    l->count++;
+    if (++l->pos == l->maxWindow) l->pos = 0;
+}
+
+float tLimiter_tick (tLimiter* const lim, float input)
+{
+    _tLimiter* l = *lim;
+    
+    limiterPeak(l, 0, input);
+    l->gain[0] = limiterGain(l, 0);
+    limiterAdvance(l);
+    
+    return tDelay_tick(&l->delays[0], input) * l->gain[0];
+}
+
+void tLimiter_tickFrame (tLimiter* const lim, float* frame)
+{
+    _tLimiter* l = *lim;
+    
+    for (int c = 0; c < l->numChannels; c++) limiterPeak(l, c, frame[c]);
+    for (int g = 0; g < l->numGroups; g++) l->gain[g] = limiterGain(l, g);
+    limiterAdvance(l);
+    
+    for (int c = 0; c < l->numChannels; c++)
+        frame[c] = tDelay_tick(&l->delays[c], frame[c]) * l->gain[l->link ? 0 : c];
+}
+
+void tLimiter_tickBlock (tLimiter* const lim, float** input, float** output, int numSamples)
+{
+    _tLimiter* l = *lim;
+    
+    for (int offset = 0; offset < numSamples; offset += LIMITER_BLOCK_SIZE)
+    {
+        int n = numSamples - offset;
+        if (n > LIMITER_BLOCK_SIZE) n = LIMITER_BLOCK_SIZE;
+        
+        // gains first, while the input is still intact
+        for (int i = 0; i < n; i++)
+        {
+            for (int c = 0; c < l->numChannels; c++) limiterPeak(l, c, input[c][offset + i]);
+            for (int g = 0; g < l->numGroups; g++)
+                l->gainBlock[g * LIMITER_BLOCK_SIZE + i] = limiterGain(l, g);
+            limiterAdvance(l);
+        }
+        
+        for (int c = 0; c < l->numChannels; c++)
+        {
+            float* out = &output[c][offset];
+            float* gain = &l->gainBlock[(l->link ? 0 : c) * LIMITER_BLOCK_SIZE];
+            tDelay_tickBlock(&l->delays[c], &input[c][offset], out, n);
+            for (int i = 0; i < n; i++) out[i] *= gain[i];
+        }
+        
+        for (int g = 0; g < l->numGroups; g++)
+            l->gain[g] = l->gainBlock[g * LIMITER_BLOCK_SIZE + n - 1];
+    }
+}
+
+void tLimiter_setCeiling (tLimiter* const lim, float ceiling)
+{
+    _tLimiter* l = *lim;
+    l->ceiling = dbtoa(ceiling);
+}
+
+void tLimiter_setLookahead (tLimiter* const lim, float lookahead)
+{
+    _tLimiter* l = *lim;
+    
+    l->lookaheadMs = lookahead;
+    int window = (int) (0.001f * lookahead * l->sampleRate) + 1;
+    l->window = LEAF_clip(1, window, l->maxWindow);
+    l->invWindow = 1.0f / (l->window * (float) LIMITER_UNITY);
+    limiterUpdateDelays(l);
+    limiterReset(l);
+}
+
+void tLimiter_setRelease (tLimiter* const lim, float release)
+{
+    _tLimiter* l = *lim;
+    
+    l->releaseMs = release;
+    l->releaseCoeff = (release > 0.0f) ? expf(-1.0f / (0.001f * release * l->sampleRate)) : 0.0f;
+}
+
+void tLimiter_setLink (tLimiter* const lim, int link)
+{
+    _tLimiter* l = *lim;
+    
+    l->link = link ? 1 : 0;
+    l->numGroups = l->link ? 1 : l->numChannels;
+    limiterReset(l);
+}
+
+void tLimiter_setTruePeak (tLimiter* const lim, int truePeak)
+{
+    _tLimiter* l = *lim;
+    
+    l->truePeak = truePeak ? 1 : 0;
+    limiterUpdateDelays(l);
+    limiterReset(l);
+}
+
+int tLimiter_getLatency (tLimiter* const lim)
+{
+    _tLimiter* l = *lim;
+    return l->window - 1 + (l->truePeak ? LIMITER_TRUE_PEAK_TAPS / 2 : 0);
+}
+
+float tLimiter_getGain (tLimiter* const lim, int channel)
+{
+    _tLimiter* l = *lim;
+    return l->gain[l->link ? 0 : channel];
+}
+
+void tLimiter_setSampleRate (tLimiter* const lim, float sr)
+{
+    _tLimiter* l = *lim;
+    
+    l->sampleRate = sr;
+    tLimiter_setRelease(lim, l->releaseMs);
+    tLimiter_setLookahead(lim, l->lookaheadMs);
+}
@@ -875,8 +875,7 @@ float       tVocoder_tick        (tVocoder* const voc, float synth, float voice)
     
     v->kout = oo;
     v->kval = k & 0x1;
-#ifdef NO_DENORMAL_CHECK
-#else
+#if !LEAF_NO_DENORMAL_CHECK
     if(fabs(v->f[0][11])<1.0e-10) v->f[0][11] = 0.0f; //catch HF envelope denormal
     
     for(i=1;i<nb;i++)
@@ -61,6 +61,9 @@ static void wdf_init(tWDF* const wdf, WDFComponentType type, float value, tWDF*
     r->reflected_wave_right = 0.0f;
     r->sample_rate = leaf->sampleRate;
     r->value = value;
+    r->table = NULL;
+    r->table_size = 0;
+    r->table_error = 0.0f;
     
     tWDF* child;
     if (r->child_left != NULL) child = r->child_left;
@@ -173,7 +176,8 @@ void tWDF_init(tWDF* const wdf, WDFComponentType type, float value, tWDF* const
 void    tWDF_initToPool(tWDF* const wdf, WDFComponentType type, float value, tWDF* const rL, tWDF* const rR, tMempool* const mp)
 {
     _tMempool* m = *mp;
-    *wdf = (_tWDF*) mpool_alloc(sizeof(_tWDF), m);
+    _tWDF* r = *wdf = (_tWDF*) mpool_alloc(sizeof(_tWDF), m);
+    r->mempool = m;
     
     wdf_init(wdf, type, value, rL, rR);
 }
@@ -182,6 +186,7 @@ void    tWDF_free (tWDF* const wdf)
 {
     _tWDF* r = *wdf;
     
+    if (r->table != NULL) mpool_free((char*)r->table, r->mempool);
     mpool_free((char*)r, r->mempool);
 }
 
@@ -522,23 +527,551 @@ static float lambertW(float a, float r, float I, float iVT)
 
 #define Is_DIODE    2.52e-9f
 #define VT_DIODE    0.02585f
-static float get_reflected_wave_for_diode(tWDF* const wdf, float input, float incident_wave)
+static float diode_reflect(float a, float r)
 {
-    _tWDF* n = *wdf;
-    
-    float a = incident_wave;
-    float r = n->port_resistance_up;
     return a + 2.0f*r*Is_DIODE - 2.0f*VT_DIODE*lambertW(a, r, Is_DIODE, 1.0f/VT_DIODE);
 }
 
-static float get_reflected_wave_for_diode_pair(tWDF* const wdf, float input, float incident_wave)
+static float diode_pair_reflect(float a, float r)
 {
-    _tWDF* n = *wdf;
-    
-    float a = incident_wave;
     float sgn = 0.0f;
     if (a > 0.0f) sgn = 1.0f;
     else if (a < 0.0f) sgn = -1.0f;
-    float r = n->port_resistance_up;
     return a + 2 * sgn * (r*Is_DIODE - VT_DIODE*lambertW(sgn*a, r, Is_DIODE, 1.0f/VT_DIODE));
 }
+
+// Tables are built from a fully converged Wright omega. The single Newton
+// step above leaves a jump of a few millivolts in the reflected wave where
+// wrightOmega3 switches pieces, which no table could follow.
+static float diode_omega(float a, float r)
+{
+    float x = ((a + r*Is_DIODE) / VT_DIODE) + logf((r * Is_DIODE) / VT_DIODE);
+    float w = wrightOmegaApproximation(x);
+    for (int i = 0; i < 3; i++) w = w - ((w - expf(x - w)) / (w + 1.0f));
+    return w;
+}
+
+static float diode_table_exact(_tWDF* const n, float a, float r)
+{
+    float sgn = 1.0f;
+    if (n->type == DiodePair)
+    {
+        if (a == 0.0f) return 0.0f;
+        if (a < 0.0f) sgn = -1.0f;
+        a = fabsf(a);
+    }
+    return sgn * (a + 2.0f*r*Is_DIODE - 2.0f*VT_DIODE*diode_omega(a, r));
+}
+
+// slope of the reflected wave, from dW/dx = W / (1 + W). The pair's slope is
+// even, so it is taken at |a|; the single diode has no symmetry.
+static float diode_table_slope(_tWDF* const n, float a, float r)
+{
+    if (n->type == DiodePair) a = fabsf(a);
+    float w = diode_omega(a, r);
+    return 1.0f - 2.0f * w / (1.0f + w);
+}
+
+// A table only holds for the port resistance it was built at. Until it is
+// rebuilt from the control path the exact solve is used instead.
+static inline int diode_table_ready(_tWDF* const n)
+{
+    return n->table != NULL && n->table_resistance == n->port_resistance_up;
+}
+
+// Cubic Hermite between the two knots around a. The diode pair is odd, so
+// its table only covers the positive half.
+static inline float diode_table_lookup(_tWDF* const n, float a)
+{
+    float sgn = 1.0f;
+    if (n->type == DiodePair && a < 0.0f)
+    {
+        sgn = -1.0f;
+        a = -a;
+    }
+    
+    float x = (a - n->table_min) * n->table_scale;
+    if (x < 0.0f || x >= (float) n->table_size)
+        return sgn * diode_table_exact(n, a, n->port_resistance_up);
+    
+    int i = (int) x;
+    float t = x - i;
+    float* k = &n->table[i * 2];
+    float y0 = k[0], m0 = k[1], y1 = k[2], m1 = k[3];
+    float c2 = 3.0f * (y1 - y0) - 2.0f * m0 - m1;
+    float c3 = 2.0f * (y0 - y1) + m0 + m1;
+    
+    return sgn * (y0 + t * (m0 + t * (c2 + t * c3)));
+}
+
+static void diode_table_fill(_tWDF* const n, float r)
+{
+    float h = 1.0f / n->table_scale;
+    for (int i = 0; i <= n->table_size; i++)
+    {
+        float a = n->table_min + i * h;
+        n->table[i * 2] = diode_table_exact(n, a, r);
+        n->table[i * 2 + 1] = diode_table_slope(n, a, r) * h;
+    }
+}
+
+// Largest difference from the exact solve at the quarter points of every
+// segment. It is a sampled estimate of the interpolation error, not a bound.
+static float diode_table_measure(_tWDF* const n, float r)
+{
+    float h = 1.0f / n->table_scale;
+    float error = 0.0f;
+    for (int i = 0; i < n->table_size; i++)
+    {
+        for (int j = 1; j < 4; j++)
+        {
+            float a = n->table_min + (i + j * 0.25f) * h;
+            float e = fabsf(diode_table_lookup(n, a) - diode_table_exact(n, a, r));
+            if (e > error) error = e;
+        }
+    }
+    return error;
+}
+
+static void diode_table_build(_tWDF* const n)
+{
+    float r = n->port_resistance_up;
+    int size = WDF_TABLE_MIN_SIZE;
+    
+    n->table_min = (n->type == DiodePair) ? 0.0f : -n->table_range;
+    
+    while (1)
+    {
+        if (n->table != NULL && n->table_size != size)
+        {
+            mpool_free((char*)n->table, n->mempool);
+            n->table = NULL;
+        }
+        if (n->table == NULL) n->table = (float*) mpool_alloc(sizeof(float) * (size + 1) * 2, n->mempool);
+        
+        n->table_size = size;
+        n->table_scale = size / (n->table_range - n->table_min);
+        diode_table_fill(n, r);
+        n->table_error = diode_table_measure(n, r);
+        
+        if (n->table_error <= n->table_tolerance || size >= WDF_TABLE_MAX_SIZE) break;
+        size *= 2;
+    }
+    
+    n->table_resistance = r;
+}
+
+static float get_reflected_wave_for_diode(tWDF* const wdf, float input, float incident_wave)
+{
+    _tWDF* n = *wdf;
+    if (diode_table_ready(n)) return diode_table_lookup(n, incident_wave);
+    return diode_reflect(incident_wave, n->port_resistance_up);
+}
+
+static float get_reflected_wave_for_diode_pair(tWDF* const wdf, float input, float incident_wave)
+{
+    _tWDF* n = *wdf;
+    if (diode_table_ready(n)) return diode_table_lookup(n, incident_wave);
+    return diode_pair_reflect(incident_wave, n->port_resistance_up);
+}
+
+float   tWDF_setDiodeTable          (tWDF* const wdf, float range, float tolerance)
+{
+    _tWDF* n = *wdf;
+    
+    if (n->type != Diode && n->type != DiodePair) return 0.0f;
+    
+    n->table_range = fabsf(range);
+    n->table_tolerance = tolerance;
+    diode_table_build(n);
+    
+    return n->table_error;
+}
+
+float   tWDF_updateDiodeTable       (tWDF* const wdf)
+{
+    _tWDF* n = *wdf;
+    
+    if (n->table != NULL && n->table_resistance != n->port_resistance_up) diode_table_build(n);
+    
+    return n->table_error;
+}
+
+void    tWDF_disableDiodeTable      (tWDF* const wdf)
+{
+    _tWDF* n = *wdf;
+    
+    if (n->table != NULL) mpool_free((char*)n->table, n->mempool);
+    n->table = NULL;
+    n->table_size = 0;
+    n->table_error = 0.0f;
+}
+
+float   tWDF_getDiodeTableError     (tWDF* const wdf)
+{
+    _tWDF* n = *wdf;
+    return n->table_error;
+}
+
+
+//===================================================================
+//================ Compiled Program =================================
+
+static int wdf_program_count(tWDF* const wdf)
+{
+    if (wdf == NULL) return 0;
+    _tWDF* r = *wdf;
+    return 1 + wdf_program_count(r->child_left) + wdf_program_count(r->child_right);
+}
+
+// Emits children before their parent, so the up pass can run front to back
+// and the down pass back to front.
+static int wdf_program_emit(_tWDFProgram* p, tWDF* const wdf)
+{
+    _tWDF* r = *wdf;
+    
+    int left = p->nullIndex;
+    int right = p->nullIndex;
+    if (r->child_left != NULL) left = wdf_program_emit(p, r->child_left);
+    if (r->child_right != NULL) right = wdf_program_emit(p, r->child_right);
+    
+    int i = p->numOps++;
+    tWDFOp* op = &p->ops[i];
+    op->type = r->type;
+    op->parent = -1;
+    op->left = left;
+    op->right = right;
+    op->sign = (r->type == Inductor) ? -1.0f : 1.0f;
+    if (left != p->nullIndex) p->ops[left].parent = i;
+    if (right != p->nullIndex) p->ops[right].parent = i;
+    p->nodes[i] = r;
+    
+    return i;
+}
+
+// Recomputes one op's port resistance and coefficients from its component
+// value and its children's port resistances, and mirrors them into the node.
+static void wdf_program_update_op(_tWDFProgram* p, int i)
+{
+    tWDFOp* op = &p->ops[i];
+    _tWDF* r = p->nodes[i];
+    
+    op->up_left = 0.0f;
+    op->up_right = 0.0f;
+    op->up_state = 0.0f;
+    op->up_input = 0.0f;
+    for (int k = 0; k < 3; k++)
+    {
+        op->down_left[k] = 0.0f;
+        op->down_right[k] = 0.0f;
+    }
+    
+    if (op->type == Resistor || op->type == ResistiveSource)
+    {
+        op->port_resistance = r->value;
+        op->port_conductance = 1.0f / r->value;
+        if (op->type == ResistiveSource) op->up_input = 1.0f;
+    }
+    else if (op->type == Capacitor)
+    {
+        op->port_conductance = r->sample_rate * 2.0f * r->value;
+        op->port_resistance = 1.0f / op->port_conductance;
+        op->up_state = 1.0f;
+    }
+    else if (op->type == Inductor)
+    {
+        op->port_resistance = r->sample_rate * 2.0f * r->value;
+        op->port_conductance = 1.0f / op->port_resistance;
+        op->up_state = 1.0f;
+    }
+    else if (op->type == Inverter)
+    {
+        op->port_resistance = p->ops[op->left].port_resistance;
+        op->port_conductance = 1.0f / op->port_resistance;
+        op->up_left = -1.0f;
+        op->down_left[2] = -1.0f;
+    }
+    else if (op->type == SeriesAdaptor)
+    {
+        float rl = p->ops[op->left].port_resistance;
+        float rr = p->ops[op->right].port_resistance;
+        op->port_resistance = rl + rr;
+        op->port_conductance = 1.0f / op->port_resistance;
+        r->gamma_zero = 1.0f / (rr + rl);
+        float gamma_left = rl * r->gamma_zero;
+        float gamma_right = rr * r->gamma_zero;
+        
+        op->up_left = -1.0f;
+        op->up_right = -1.0f;
+        op->down_left[0] = gamma_right;
+        op->down_left[1] = -gamma_left;
+        op->down_left[2] = -gamma_left;
+        op->down_right[0] = -gamma_right;
+        op->down_right[1] = gamma_left;
+        op->down_right[2] = -gamma_right;
+        
+        r->port_resistance_left = rl;
+        r->port_resistance_right = rr;
+        r->port_conductance_left = 1.0f / rl;
+        r->port_conductance_right = 1.0f / rr;
+    }
+    else if (op->type == ParallelAdaptor)
+    {
+        float rl = p->ops[op->left].port_resistance;
+        float rr = p->ops[op->right].port_resistance;
+        op->port_resistance = (rl * rr) / (rl + rr);
+        op->port_conductance = 1.0f / op->port_resistance;
+        r->port_conductance_left = 1.0f / rl;
+        r->port_conductance_right = 1.0f / rr;
+        r->gamma_zero = 1.0f / (r->port_conductance_right + r->port_conductance_left);
+        float gamma_left = r->port_conductance_left * r->gamma_zero;
+        float gamma_right = r->port_conductance_right * r->gamma_zero;
+        
+        op->up_left = gamma_left;
+        op->up_right = gamma_right;
+        op->down_left[0] = gamma_left - 1.0f;
+        op->down_left[1] = gamma_right;
+        op->down_left[2] = 1.0f;
+        op->down_right[0] = gamma_left;
+        op->down_right[1] = gamma_right - 1.0f;
+        op->down_right[2] = 1.0f;
+        
+        r->port_resistance_left = rl;
+        r->port_resistance_right = rr;
+    }
+    
+    // fold in the inversion inductors apply to their incident wave
+    if (op->left != p->nullIndex)
+        for (int k = 0; k < 3; k++) op->down_left[k] *= p->ops[op->left].sign;
+    if (op->right != p->nullIndex)
+        for (int k = 0; k < 3; k++) op->down_right[k] *= p->ops[op->right].sign;
+    
+    r->port_resistance_up = op->port_resistance;
+    r->port_conductance_up = op->port_conductance;
+}
+
+static void wdf_program_update_root(_tWDFProgram* p)
+{
+    _tWDF* root = *p->root;
+    p->root_resistance = p->ops[p->childIndex].port_resistance;
+    root->port_resistance_up = p->root_resistance;
+    root->port_conductance_up = 1.0f / p->root_resistance;
+}
+
+static int wdf_program_find(_tWDFProgram* p, tWDF* const node)
+{
+    if (node == NULL) return p->nullIndex;
+    if (*node == *p->root) return p->rootIndex;
+    for (int i = 0; i < p->numOps; i++)
+    {
+        if (p->nodes[i] == *node) return i;
+    }
+    return p->nullIndex;
+}
+
+static void wdf_program_release(_tWDFProgram* p)
+{
+    if (p->ops == NULL) return;
+    mpool_free((char*)p->ops, p->mempool);
+    mpool_free((char*)p->nodes, p->mempool);
+    mpool_free((char*)p->scatter, p->mempool);
+    mpool_free((char*)p->a, p->mempool);
+    mpool_free((char*)p->b, p->mempool);
+    p->ops = NULL;
+}
+
+void    tWDFProgram_init            (tWDFProgram* const prog, tWDF* const root, tWDF* const outputPoint, LEAF* const leaf)
+{
+    tWDFProgram_initToPool(prog, root, outputPoint, &leaf->mempool);
+}
+
+void    tWDFProgram_initToPool      (tWDFProgram* const prog, tWDF* const root, tWDF* const outputPoint, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tWDFProgram* p = *prog = (_tWDFProgram*) mpool_alloc(sizeof(_tWDFProgram), m);
+    p->mempool = m;
+    
+    p->root = root;
+    p->output = outputPoint;
+    p->ops = NULL;
+    
+    tWDFProgram_compile(prog);
+}
+
+void    tWDFProgram_free            (tWDFProgram* const prog)
+{
+    _tWDFProgram* p = *prog;
+    
+    wdf_program_release(p);
+    mpool_free((char*)p, p->mempool);
+}
+
+void    tWDFProgram_compile         (tWDFProgram* const prog)
+{
+    _tWDFProgram* p = *prog;
+    _tWDF* root = *p->root;
+    
+    // the running program keeps its state in its own arrays, so hold on to
+    // them until the state has been carried over
+    _tWDFProgram old = *p;
+    p->ops = NULL;
+    
+    tWDF* child;
+    if (root->child_left != NULL) child = root->child_left;
+    else child = root->child_right;
+    
+    int n = wdf_program_count(child);
+    p->ops = (tWDFOp*) mpool_alloc(sizeof(tWDFOp) * n, p->mempool);
+    p->nodes = (_tWDF**) mpool_alloc(sizeof(_tWDF*) * n, p->mempool);
+    p->scatter = (int*) mpool_alloc(sizeof(int) * n, p->mempool);
+    p->a = (float*) mpool_calloc(sizeof(float) * (n + 2), p->mempool);
+    p->b = (float*) mpool_calloc(sizeof(float) * (n + 2), p->mempool);
+    
+    p->nullIndex = n;
+    p->rootIndex = n + 1;
+    p->numOps = 0;
+    p->childIndex = wdf_program_emit(p, child);
+    p->rootType = root->type;
+    
+    p->numScatter = 0;
+    for (int i = n - 1; i >= 0; i--)
+    {
+        WDFComponentType type = p->ops[i].type;
+        if (type == SeriesAdaptor || type == ParallelAdaptor || type == Inverter)
+            p->scatter[p->numScatter++] = i;
+    }
+    
+    for (int i = 0; i < n; i++) wdf_program_update_op(p, i);
+    wdf_program_update_root(p);
+    
+    // carry over the state of nodes the old program ran, and the tree's own
+    // state for new ones, so compiling mid-stream doesn't click
+    for (int i = 0; i < n; i++)
+    {
+        p->a[i] = p->nodes[i]->incident_wave_up;
+        p->b[i] = p->nodes[i]->reflected_wave_up;
+        for (int j = 0; old.ops != NULL && j < old.numOps; j++)
+        {
+            if (old.nodes[j] != p->nodes[i]) continue;
+            p->a[i] = old.a[j];
+            p->b[i] = old.b[j];
+            break;
+        }
+    }
+    p->a[p->rootIndex] = root->incident_wave_up;
+    p->b[p->rootIndex] = root->reflected_wave_up;
+    if (old.ops != NULL)
+    {
+        p->a[p->rootIndex] = old.a[old.rootIndex];
+        p->b[p->rootIndex] = old.b[old.rootIndex];
+    }
+    wdf_program_release(&old);
+    
+    p->outputIndex = wdf_program_find(p, p->output);
+}
+
+static inline float wdf_program_tick(_tWDFProgram* p, float input)
+{
+    tWDFOp* ops = p->ops;
+    float* a = p->a;
+    float* b = p->b;
+    
+    // scan the waves up the tree
+    for (int i = 0; i < p->numOps; i++)
+    {
+        tWDFOp* op = &ops[i];
+        b[i] = op->up_left * b[op->left] + op->up_right * b[op->right] + op->up_state * a[i] + op->up_input * input;
+    }
+    
+    // root scattering
+    int c = p->childIndex;
+    int rt = p->rootIndex;
+    a[rt] = b[c];
+    _tWDF* root = *p->root;
+    if (diode_table_ready(root))        b[rt] = diode_table_lookup(root, a[rt]);
+    else if (p->rootType == Diode)      b[rt] = diode_reflect(a[rt], p->root_resistance);
+    else if (p->rootType == DiodePair)  b[rt] = diode_pair_reflect(a[rt], p->root_resistance);
+    else                                b[rt] = (2.0f * input) - a[rt];
+    a[c] = ops[c].sign * b[rt];
+    
+    // propagate waves down the tree
+    for (int k = 0; k < p->numScatter; k++)
+    {
+        tWDFOp* op = &ops[p->scatter[k]];
+        float bl = b[op->left];
+        float br = b[op->right];
+        float x = a[p->scatter[k]];
+        a[op->left] = op->down_left[0] * bl + op->down_left[1] * br + op->down_left[2] * x;
+        a[op->right] = op->down_right[0] * bl + op->down_right[1] * br + op->down_right[2] * x;
+    }
+    
+    int o = p->outputIndex;
+    return (a[o] * 0.5f) + (b[o] * 0.5f);
+}
+
+float   tWDFProgram_tick            (tWDFProgram* const prog, float sample)
+{
+    _tWDFProgram* p = *prog;
+    return wdf_program_tick(p, sample);
+}
+
+void    tWDFProgram_tickBlock       (tWDFProgram* const prog, float* input, float* output, int numSamples)
+{
+    _tWDFProgram* p = *prog;
+    for (int i = 0; i < numSamples; i++) output[i] = wdf_program_tick(p, input[i]);
+}
+
+void    tWDFProgram_setValue        (tWDFProgram* const prog, tWDF* const component, float value)
+{
+    _tWDFProgram* p = *prog;
+    
+    tWDF_setValue(component, value);
+    
+    int i = wdf_program_find(p, component);
+    if (i >= p->numOps) return;
+    
+    // only the path to the root depends on this component
+    while (i >= 0)
+    {
+        wdf_program_update_op(p, i);
+        i = p->ops[i].parent;
+    }
+    wdf_program_update_root(p);
+}
+
+void    tWDFProgram_setOutputPoint  (tWDFProgram* const prog, tWDF* const outputPoint)
+{
+    _tWDFProgram* p = *prog;
+    p->output = outputPoint;
+    p->outputIndex = wdf_program_find(p, outputPoint);
+}
+
+float   tWDFProgram_getVoltage      (tWDFProgram* const prog, tWDF* const node)
+{
+    _tWDFProgram* p = *prog;
+    int i = wdf_program_find(p, node);
+    return (p->a[i] * 0.5f) + (p->b[i] * 0.5f);
+}
+
+float   tWDFProgram_getCurrent      (tWDFProgram* const prog, tWDF* const node)
+{
+    _tWDFProgram* p = *prog;
+    int i = wdf_program_find(p, node);
+    float conductance = 0.0f;
+    if (i < p->numOps) conductance = p->ops[i].port_conductance;
+    else if (i == p->rootIndex) conductance = 1.0f / p->root_resistance;
+    return ((p->a[i] * 0.5f) - (p->b[i] * 0.5f)) * conductance;
+}
+
+void    tWDFProgram_setSampleRate   (tWDFProgram* const prog, float sample_rate)
+{
+    _tWDFProgram* p = *prog;
+    
+    tWDF_setSampleRate(p->root, sample_rate);
+    for (int i = 0; i < p->numOps; i++)
+    {
+        tWDF_setSampleRate(&p->nodes[i], sample_rate);
+        wdf_program_update_op(p, i);
+    }
+    wdf_program_update_root(p);
+}
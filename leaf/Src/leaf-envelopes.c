@@ -23,6 +23,17 @@
 
 #endif
 
+// For the control-rate tickBlocks of the table envelopes: the number of ticks, at most n,
+// that a stage can be advanced in one step before its phase passes end. A stage already
+// past its end needs its end-of-stage tick, which doesn't advance the phase, so that is
+// taken as a single sample.
+static int envelopeStageSteps(float phase, float inc, float end, int n)
+{
+    if (phase > end) return 1;
+    float m = (end - phase) / inc + 1.0f;
+    return (m < (float) n) ? (int) m : n;
+}
+
 #if LEAF_INCLUDE_ADSR_TABLES
 // ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ Envelope ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ //
 void    tEnvelope_init(tEnvelope* const envlp, float attack, float decay, int loop, LEAF* const leaf)
@@ -70,6 +81,11 @@ void    tEnvelope_initToPool    (tEnvelope* const envlp, float attack, float dec
     env->attackInc = env->inc_buff[attackIndex];
     env->decayInc = env->inc_buff[decayIndex];
     env->rampInc = env->inc_buff[rampIndex];
+    
+    env->controlRate = 0;
+    env->controlCount = 0;
+    env->controlValue = 0.0f;
+    env->controlInc = 0.0f;
 }
 
 void    tEnvelope_free  (tEnvelope* const envlp)
@@ -140,10 +156,10 @@ void     tEnvelope_on(tEnvelope* const envlp, float velocity)
     env->gain = velocity;
 }
 
-float   tEnvelope_tick(tEnvelope* const envlp)
+// Advances the envelope by scale samples; tEnvelope_tickBlock uses this at control rate.
+// The result is the value at the phase before the advance, as in tEnvelope_tick.
+static float envelopeTick(_tEnvelope* env, float scale)
 {
-    _tEnvelope* env = *envlp;
-    
     if (env->inRamp)
     {
         if (env->rampPhase > UINT16_MAX)
@@ -157,7 +173,7 @@ float   tEnvelope_tick(tEnvelope* const envlp)
             env->next = env->rampPeak * env->exp_buff[(uint32_t)env->rampPhase];
         }
         
-        env->rampPhase += env->rampInc;
+        env->rampPhase += env->rampInc * scale;
     }
     
     if (env->inAttack)
@@ -177,7 +193,7 @@ float   tEnvelope_tick(tEnvelope* const envlp)
         }
         
         // Increment envelope attack.
-        env->attackPhase += env->attackInc;
+        env->attackPhase += env->attackInc * scale;
         
     }
     
@@ -206,11 +222,56 @@ float   tEnvelope_tick(tEnvelope* const envlp)
         }
         
         // Increment envelope decay;
-        env->decayPhase += env->decayInc;
+        env->decayPhase += env->decayInc * scale;
     }
     
     return env->next;
 }
+
+float   tEnvelope_tick(tEnvelope* const envlp)
+{
+    return envelopeTick(*envlp, 1.0f);
+}
+
+// Advances k samples and returns the value tEnvelope_tick would give on the last of them.
+// Stage ends land on the same sample as at audio rate.
+static float envelopeAdvance(_tEnvelope* env, int k)
+{
+    int n = k - 1;
+    while (n > 0)
+    {
+        int steps = n;
+        if (env->inRamp) steps = envelopeStageSteps(env->rampPhase, env->rampInc, UINT16_MAX, steps);
+        if (env->inAttack) steps = envelopeStageSteps(env->attackPhase, env->attackInc, UINT16_MAX, steps);
+        if (env->inDecay) steps = envelopeStageSteps(env->decayPhase, env->decayInc, UINT16_MAX, steps);
+        envelopeTick(env, (float) steps);
+        n -= steps;
+    }
+    return envelopeTick(env, 1.0f);
+}
+
+void    tEnvelope_tickBlock(tEnvelope* const envlp, float* output, int numSamples)
+{
+    _tEnvelope* env = *envlp;
+    int k = (env->controlRate > 0) ? env->controlRate : env->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (env->controlCount == 0)
+        {
+            float target = envelopeAdvance(env, k);
+            env->controlInc = (target - env->controlValue) / (float) k;
+            env->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &env->controlValue, env->controlInc, &env->controlCount);
+    }
+}
+
+void    tEnvelope_setControlRate(tEnvelope* const envlp, int controlRate)
+{
+    _tEnvelope* env = *envlp;
+    env->controlRate = (controlRate > 0) ? controlRate : 0;
+}
 #endif // LEAF_INCLUDE_ADSR_TABLES
 
 #if LEAF_INCLUDE_ADSR_TABLES
@@ -688,6 +749,362 @@ void tADSRS_setSampleRate(tADSRS* const adsrenv, float sr)
 
 //================================================================================
 
+/* ADSR Bank */ // tADSRS envelopes for a whole voice pool, rendered in blocks
+#define ADSRBANK_FOREVER (1 << 30)
+
+void    tADSRBank_init(tADSRBank* const bank, int numVoices, float attack, float decay, float sustain, float release, LEAF* const leaf)
+{
+    tADSRBank_initToPool(bank, numVoices, attack, decay, sustain, release, &leaf->mempool);
+}
+
+void    tADSRBank_initToPool(tADSRBank* const bank, int numVoices, float attack, float decay, float sustain, float release, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tADSRBank* b = *bank = (_tADSRBank*) mpool_alloc(sizeof(_tADSRBank), m);
+    b->mempool = m;
+    LEAF* leaf = b->mempool->leaf;
+    
+    if (numVoices < 1) numVoices = 1;
+    b->numVoices = numVoices;
+    int n = b->numLanes = ((numVoices + ADSRBANK_LANES - 1) / ADSRBANK_LANES) * ADSRBANK_LANES;
+    
+    b->voices = (float*) mpool_calloc(sizeof(float) * n * 6, m);
+    b->output            = b->voices;
+    b->gain              = b->voices + n;
+    b->targetGainSquared = b->voices + n * 2;
+    b->base              = b->voices + n * 3;
+    b->coef              = b->voices + n * 4;
+    b->mul               = b->voices + n * 5;
+    b->stage = (int*) mpool_calloc(sizeof(int) * n * 2, m);
+    b->remaining = b->stage + n;
+    
+    b->scratch = (float*) mpool_alloc(sizeof(float) * n * ADSRBANK_CHUNK, m);
+    
+    b->sampleRate = leaf->sampleRate;
+    b->sampleRateInMs = b->sampleRate * 0.001f;
+    b->invSampleRate = leaf->invSampleRate;
+    b->targetRatioA = 0.3f;
+    b->targetRatioDR = 0.0001f;
+    b->sustainLevel = sustain;
+    b->baseLeakFactor = 1.0f;
+    b->leakFactor = 1.0f;
+    b->factor = 0.01f;
+    b->oneMinusFactor = 0.99f;
+    
+    for (int v = 0; v < n; v++)
+    {
+        b->gain[v] = 1.0f;
+        b->targetGainSquared[v] = 1.0f;
+        b->coef[v] = 1.0f;
+        b->mul[v] = 1.0f;
+        b->stage[v] = env_idle;
+        b->remaining[v] = ADSRBANK_FOREVER;
+    }
+    
+    tADSRBank_setAttack(bank, attack);
+    tADSRBank_setDecay(bank, decay);
+    tADSRBank_setRelease(bank, release);
+}
+
+void    tADSRBank_free(tADSRBank* const bank)
+{
+    _tADSRBank* b = *bank;
+    
+    mpool_free((char*)b->scratch, b->mempool);
+    mpool_free((char*)b->stage, b->mempool);
+    mpool_free((char*)b->voices, b->mempool);
+    mpool_free((char*)b, b->mempool);
+}
+
+// Number of samples a voice can run in its current stage before it might reach the
+// stage threshold. The segment approaches base / (1 - coef) geometrically, so the
+// crossing is found with one log; the margin covers rounding in the recurrence and
+// the voice is checked again once it runs out.
+static int adsrBankSpan(_tADSRBank* b, int v)
+{
+    float threshold;
+    switch (b->stage[v])
+    {
+        case env_attack:  threshold = 1.0f; break;
+        case env_decay:   threshold = b->sustainLevel; break;
+        case env_release: threshold = 0.0f; break;
+        default:          return ADSRBANK_FOREVER;
+    }
+    
+    float c = b->coef[v] * b->mul[v];
+    if (c <= 0.0f || c >= 1.0f) return 0;
+    
+    float target = b->base[v] / (1.0f - c);
+    float start = b->output[v] - target;
+    if (start == 0.0f) return 0;
+    float ratio = (threshold - target) / start;
+    if (ratio <= 0.0f || ratio >= 1.0f) return 0;
+    
+    float n = logf(ratio) / logf(c);
+    if (n > (float) ADSRBANK_FOREVER) return ADSRBANK_FOREVER;
+    int span = (int) (n * 0.95f) - 2;
+    return (span > 0) ? span : 0;
+}
+
+static void adsrBankEnter(_tADSRBank* b, int v, int stage)
+{
+    b->stage[v] = stage;
+    b->mul[v] = 1.0f;
+    switch (stage)
+    {
+        case env_attack:
+            b->base[v] = b->attackBase;
+            b->coef[v] = b->attackCoef;
+            break;
+        case env_decay:
+            b->base[v] = b->decayBase;
+            b->coef[v] = b->decayCoef;
+            b->mul[v] = b->leakFactor;
+            break;
+        case env_sustain:
+            b->base[v] = 0.0f;
+            b->coef[v] = b->leakFactor;
+            break;
+        case env_release:
+            b->base[v] = b->releaseBase;
+            b->coef[v] = b->releaseCoef;
+            break;
+        default:
+            b->base[v] = 0.0f;
+            b->coef[v] = 1.0f;
+            break;
+    }
+    b->remaining[v] = adsrBankSpan(b, v);
+}
+
+// One sample of a voice with the stage tests of tADSRS_tick.
+static void adsrBankStep(_tADSRBank* b, int v)
+{
+    float out = b->base[v] + b->output[v] * b->coef[v] * b->mul[v];
+    int stage = b->stage[v];
+    
+    if (stage == env_attack && out >= 1.0f)
+    {
+        b->output[v] = 1.0f;
+        adsrBankEnter(b, v, env_decay);
+    }
+    else if (stage == env_decay && out <= b->sustainLevel)
+    {
+        b->output[v] = b->sustainLevel;
+        adsrBankEnter(b, v, env_sustain);
+    }
+    else if (stage == env_release && out <= 0.0f)
+    {
+        b->output[v] = 0.0f;
+        adsrBankEnter(b, v, env_idle);
+    }
+    else
+    {
+        b->output[v] = out;
+        b->remaining[v] = adsrBankSpan(b, v);
+    }
+}
+
+// Runs every voice for numSamples samples with no stage tests, writing into the
+// scratch buffer from sample offset pos. Voices are run in groups of ADSRBANK_LANES
+// held in local arrays so the inner loop can be vectorized.
+static void adsrBankRun(_tADSRBank* b, int pos, int numSamples)
+{
+    int n = b->numLanes;
+    float f = b->factor;
+    float omf = b->oneMinusFactor;
+    
+    for (int g = 0; g < n; g += ADSRBANK_LANES)
+    {
+        float out[ADSRBANK_LANES], gain[ADSRBANK_LANES], tgs[ADSRBANK_LANES];
+        float base[ADSRBANK_LANES], coef[ADSRBANK_LANES], mul[ADSRBANK_LANES];
+        for (int l = 0; l < ADSRBANK_LANES; l++)
+        {
+            out[l] = b->output[g + l];
+            gain[l] = b->gain[g + l];
+            tgs[l] = b->targetGainSquared[g + l];
+            base[l] = b->base[g + l];
+            coef[l] = b->coef[g + l];
+            mul[l] = b->mul[g + l];
+        }
+        
+        float* dst = b->scratch + pos * n + g;
+        for (int i = 0; i < numSamples; i++)
+        {
+            for (int l = 0; l < ADSRBANK_LANES; l++)
+            {
+                out[l] = base[l] + out[l] * coef[l] * mul[l];
+                gain[l] = (f * tgs[l]) + (omf * gain[l]);
+                dst[l] = out[l] * gain[l];
+            }
+            dst += n;
+        }
+        
+        for (int l = 0; l < ADSRBANK_LANES; l++)
+        {
+            b->output[g + l] = out[l];
+            b->gain[g + l] = gain[l];
+        }
+    }
+}
+
+static void adsrBankProcess(_tADSRBank* b, float** output, int offset, int numSamples)
+{
+    int n = b->numLanes;
+    int pos = 0;
+    
+    while (pos < numSamples)
+    {
+        int run = numSamples - pos;
+        for (int v = 0; v < n; v++) if (b->remaining[v] < run) run = b->remaining[v];
+        
+        if (run > 0)
+        {
+            adsrBankRun(b, pos, run);
+            for (int v = 0; v < n; v++) b->remaining[v] -= run;
+            pos += run;
+        }
+        else
+        {
+            // at least one voice is due for a stage test
+            float* dst = b->scratch + pos * n;
+            for (int v = 0; v < n; v++)
+            {
+                if (b->remaining[v] == 0) adsrBankStep(b, v);
+                else
+                {
+                    b->output[v] = b->base[v] + b->output[v] * b->coef[v] * b->mul[v];
+                    b->remaining[v]--;
+                }
+                b->gain[v] = (b->factor * b->targetGainSquared[v]) + (b->oneMinusFactor * b->gain[v]);
+                dst[v] = b->output[v] * b->gain[v];
+            }
+            pos++;
+        }
+    }
+    
+    if (output == NULL) return;
+    for (int v = 0; v < b->numVoices; v++)
+    {
+        if (output[v] == NULL) continue;
+        float* src = b->scratch + v;
+        float* dst = output[v] + offset;
+        for (int i = 0; i < numSamples; i++) dst[i] = src[i * n];
+    }
+}
+
+void    tADSRBank_tick(tADSRBank* const bank, float* output)
+{
+    _tADSRBank* b = *bank;
+    
+    adsrBankProcess(b, NULL, 0, 1);
+    for (int v = 0; v < b->numVoices; v++) output[v] = b->scratch[v];
+}
+
+void    tADSRBank_tickBlock(tADSRBank* const bank, float** output, int numSamples)
+{
+    _tADSRBank* b = *bank;
+    
+    for (int offset = 0; offset < numSamples; offset += ADSRBANK_CHUNK)
+    {
+        int n = numSamples - offset;
+        if (n > ADSRBANK_CHUNK) n = ADSRBANK_CHUNK;
+        adsrBankProcess(b, output, offset, n);
+    }
+}
+
+void    tADSRBank_on(tADSRBank* const bank, int voice, float velocity)
+{
+    _tADSRBank* b = *bank;
+    if (voice < 0 || voice >= b->numVoices) return;
+    b->targetGainSquared[voice] = velocity * velocity;
+    adsrBankEnter(b, voice, env_attack);
+}
+
+void    tADSRBank_off(tADSRBank* const bank, int voice)
+{
+    _tADSRBank* b = *bank;
+    if (voice < 0 || voice >= b->numVoices) return;
+    if (b->stage[voice] != env_idle) adsrBankEnter(b, voice, env_release);
+}
+
+int     tADSRBank_isActive(tADSRBank* const bank, int voice)
+{
+    _tADSRBank* b = *bank;
+    if (voice < 0 || voice >= b->numVoices) return 0;
+    return b->stage[voice] != env_idle;
+}
+
+static void adsrBankRefresh(_tADSRBank* b)
+{
+    for (int v = 0; v < b->numVoices; v++) adsrBankEnter(b, v, b->stage[v]);
+}
+
+void    tADSRBank_setAttack(tADSRBank* const bank, float attack)
+{
+    _tADSRBank* b = *bank;
+    
+    b->attack = attack;
+    b->attackCoef = calcADSR3Coef(attack * b->sampleRateInMs, b->targetRatioA);
+    b->attackBase = (1.0f + b->targetRatioA) * (1.0f - b->attackCoef);
+    adsrBankRefresh(b);
+}
+
+void    tADSRBank_setDecay(tADSRBank* const bank, float decay)
+{
+    _tADSRBank* b = *bank;
+    
+    b->decay = decay;
+    b->decayCoef = calcADSR3Coef(decay * b->sampleRateInMs, b->targetRatioDR);
+    b->decayBase = (b->sustainLevel - b->targetRatioDR) * (1.0f - b->decayCoef);
+    adsrBankRefresh(b);
+}
+
+void    tADSRBank_setSustain(tADSRBank* const bank, float sustain)
+{
+    _tADSRBank* b = *bank;
+    
+    b->sustainLevel = sustain;
+    b->decayBase = (b->sustainLevel - b->targetRatioDR) * (1.0f - b->decayCoef);
+    adsrBankRefresh(b);
+}
+
+void    tADSRBank_setRelease(tADSRBank* const bank, float release)
+{
+    _tADSRBank* b = *bank;
+    
+    b->release = release;
+    b->releaseCoef = calcADSR3Coef(release * b->sampleRateInMs, b->targetRatioDR);
+    b->releaseBase = -b->targetRatioDR * (1.0f - b->releaseCoef);
+    adsrBankRefresh(b);
+}
+
+// 0.999999 is slow leak, 0.9 is fast leak
+void    tADSRBank_setLeakFactor(tADSRBank* const bank, float leakFactor)
+{
+    _tADSRBank* b = *bank;
+    
+    b->baseLeakFactor = leakFactor;
+    b->leakFactor = powf(leakFactor, 44100.0f * b->invSampleRate);
+    adsrBankRefresh(b);
+}
+
+void    tADSRBank_setSampleRate(tADSRBank* const bank, float sr)
+{
+    _tADSRBank* b = *bank;
+    
+    b->sampleRate = sr;
+    b->sampleRateInMs = b->sampleRate * 0.001f;
+    b->invSampleRate = 1.0f/sr;
+    
+    tADSRBank_setAttack(bank, b->attack);
+    tADSRBank_setDecay(bank, b->decay);
+    tADSRBank_setRelease(bank, b->release);
+    tADSRBank_setLeakFactor(bank, b->baseLeakFactor);
+}
+
+//================================================================================
+
 /* ADSR 4 */ // new version of our original table-based ADSR but with the table passed in by the user
 // use this if the size of the big ADSR tables is too much.
 void    tADSRT_init    (tADSRT* const adsrenv, float attack, float decay, float sustain, float release, float* expBuffer, int bufferSize, LEAF* const leaf)
@@ -743,6 +1160,11 @@ void    tADSRT_initToPool    (tADSRT* const adsrenv, float attack, float decay,
     adsr->baseLeakFactor = 1.0f;
     adsr->leakFactor = 1.0f;
     adsr->invSampleRate = leaf->invSampleRate;
+    
+    adsr->controlRate = 0;
+    adsr->controlCount = 0;
+    adsr->controlValue = 0.0f;
+    adsr->controlInc = 0.0f;
 }
 
 void    tADSRT_free  (tADSRT* const adsrenv)
@@ -840,10 +1262,10 @@ void tADSRT_off(tADSRT* const adsrenv)
     }
 }
 
-float   tADSRT_tick(tADSRT* const adsrenv)
+// Advances the envelope by scale samples with a leak of leak per tick; tADSRT_tickBlock
+// uses this at control rate. The result is the value at the phase before the advance.
+static float adsrtTick(_tADSRT* adsr, float scale, float leak)
 {
-    _tADSRT* adsr = *adsrenv;
-
     switch (adsr->whichStage)
     {
         case env_ramp:
@@ -868,7 +1290,7 @@ float   tADSRT_tick(tADSRT* const adsrenv)
                 adsr->next = adsr->rampPeak * LEAF_interpolation_linear(adsr->exp_buff[intPart], secondValue, floatPart);
             }
 
-            adsr->rampPhase += adsr->rampInc;
+            adsr->rampPhase += adsr->rampInc * scale;
             break;
 
 
@@ -899,7 +1321,7 @@ float   tADSRT_tick(tADSRT* const adsrenv)
             }
 
             // Increment ADSR attack.
-            adsr->attackPhase += adsr->attackInc;
+            adsr->attackPhase += adsr->attackInc * scale;
             break;
 
         case env_decay:
@@ -925,15 +1347,15 @@ float   tADSRT_tick(tADSRT* const adsrenv)
                     secondValue = adsr->exp_buff[(uint32_t)((adsr->decayPhase)+1)];
                 }
                 float interpValue = (LEAF_interpolation_linear(adsr->exp_buff[intPart], secondValue, floatPart));
-                adsr->next = (adsr->gain * (adsr->sustain + (interpValue * (1.0f - adsr->sustain)))) * adsr->leakFactor; // do interpolation !
+                adsr->next = (adsr->gain * (adsr->sustain + (interpValue * (1.0f - adsr->sustain)))) * leak; // do interpolation !
             }
 
             // Increment ADSR decay.
-            adsr->decayPhase += adsr->decayInc;
+            adsr->decayPhase += adsr->decayInc * scale;
             break;
 
         case env_sustain:
-            adsr->next = adsr->next * adsr->leakFactor;
+            adsr->next = adsr->next * leak;
             break;
 
         case env_release:
@@ -959,12 +1381,63 @@ float   tADSRT_tick(tADSRT* const adsrenv)
             }
 
             // Increment envelope release;
-            adsr->releasePhase += adsr->releaseInc;
+            adsr->releasePhase += adsr->releaseInc * scale;
             break;
     }
     return adsr->next;
 }
 
+float   tADSRT_tick(tADSRT* const adsrenv)
+{
+    _tADSRT* adsr = *adsrenv;
+    return adsrtTick(adsr, 1.0f, adsr->leakFactor);
+}
+
+// Advances k samples and returns the value tADSRT_tick would give on the last of them.
+static float adsrtAdvance(_tADSRT* adsr, int k)
+{
+    float end = adsr->buff_sizeMinusOne;
+    int n = k - 1;
+    while (n > 0)
+    {
+        int steps = n;
+        switch (adsr->whichStage)
+        {
+            case env_ramp:    steps = envelopeStageSteps(adsr->rampPhase, adsr->rampInc, end, n); break;
+            case env_attack:  steps = envelopeStageSteps(adsr->attackPhase, adsr->attackInc, end, n); break;
+            case env_decay:   steps = envelopeStageSteps(adsr->decayPhase, adsr->decayInc, end, n); break;
+            case env_release: steps = envelopeStageSteps(adsr->releasePhase, adsr->releaseInc, end, n); break;
+            default: break;
+        }
+        adsrtTick(adsr, (float) steps, powf(adsr->leakFactor, (float) steps));
+        n -= steps;
+    }
+    return adsrtTick(adsr, 1.0f, adsr->leakFactor);
+}
+
+void    tADSRT_tickBlock(tADSRT* const adsrenv, float* output, int numSamples)
+{
+    _tADSRT* adsr = *adsrenv;
+    int k = (adsr->controlRate > 0) ? adsr->controlRate : adsr->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (adsr->controlCount == 0)
+        {
+            float target = adsrtAdvance(adsr, k);
+            adsr->controlInc = (target - adsr->controlValue) / (float) k;
+            adsr->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &adsr->controlValue, adsr->controlInc, &adsr->controlCount);
+    }
+}
+
+void    tADSRT_setControlRate(tADSRT* const adsrenv, int controlRate)
+{
+    _tADSRT* adsr = *adsrenv;
+    adsr->controlRate = (controlRate > 0) ? controlRate : 0;
+}
+
 float   tADSRT_tickNoInterp(tADSRT* const adsrenv)
 {
     _tADSRT* adsr = *adsrenv;
@@ -1089,6 +1562,11 @@ void    tRamp_initToPool    (tRamp* const r, float time, int samples_per_tick, t
     ramp->samples_per_tick = samples_per_tick;
     ramp->factor = (1.0f / ramp->time) * ramp->inv_sr_ms * (float)ramp->samples_per_tick;
     ramp->inc = (ramp->dest - ramp->curr) * ramp->factor;
+    
+    ramp->controlRate = 0;
+    ramp->controlCount = 0;
+    ramp->controlValue = ramp->curr;
+    ramp->controlInc = 0.0f;
 }
 
 void    tRamp_free (tRamp* const r)
@@ -1149,6 +1627,36 @@ float   tRamp_sample(tRamp* const ramp)
     return r->curr;
 }
 
+void    tRamp_tickBlock(tRamp* const ramp, float* output, int numSamples)
+{
+    _tRamp* r = *ramp;
+    int k = (r->controlRate > 0) ? r->controlRate : r->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (r->controlCount == 0)
+        {
+            // inc is per tick, and a tick covers samples_per_tick samples
+            r->curr += r->inc * ((float) k / (float) r->samples_per_tick);
+            if (((r->curr >= r->dest) && (r->inc > 0.0f)) || ((r->curr <= r->dest) && (r->inc < 0.0f)))
+            {
+                r->inc = 0.0f;
+                r->curr = r->dest;
+            }
+            float target = r->curr;
+            r->controlInc = (target - r->controlValue) / (float) k;
+            r->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &r->controlValue, r->controlInc, &r->controlCount);
+    }
+}
+
+void    tRamp_setControlRate(tRamp* const ramp, int controlRate)
+{
+    _tRamp* r = *ramp;
+    r->controlRate = (controlRate > 0) ? controlRate : 0;
+}
+
 void    tRamp_setSampleRate(tRamp* const ramp, float sr)
 {
     _tRamp* r = *ramp;
@@ -1322,6 +1830,11 @@ void    tExpSmooth_initToPool   (tExpSmooth* const expsmooth, float val, float f
     smooth->factor = factor;
     smooth->oneminusfactor = 1.0f - factor;
     smooth->invSampleRate = smooth->mempool->leaf->invSampleRate;
+    
+    smooth->controlRate = 0;
+    smooth->controlCount = 0;
+    smooth->controlValue = val;
+    smooth->controlInc = 0.0f;
 }
 
 void    tExpSmooth_free (tExpSmooth* const expsmooth)
@@ -1374,6 +1887,33 @@ float   tExpSmooth_sample(tExpSmooth* const expsmooth)
     return smooth->curr;
 }
 
+void    tExpSmooth_tickBlock(tExpSmooth* const expsmooth, float* output, int numSamples)
+{
+    _tExpSmooth* smooth = *expsmooth;
+    int k = (smooth->controlRate > 0) ? smooth->controlRate : smooth->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (smooth->controlCount == 0)
+        {
+            // k ticks in closed form: curr approaches factor * dest / (1 - oneminusfactor) geometrically
+            float coef = powf(smooth->oneminusfactor, (float) k);
+            float gain = (smooth->oneminusfactor < 1.0f) ? smooth->factor * (1.0f - coef) / (1.0f - smooth->oneminusfactor) : smooth->factor * (float) k;
+            smooth->curr = gain * smooth->dest + coef * smooth->curr;
+            float target = smooth->curr;
+            smooth->controlInc = (target - smooth->controlValue) / (float) k;
+            smooth->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &smooth->controlValue, smooth->controlInc, &smooth->controlCount);
+    }
+}
+
+void    tExpSmooth_setControlRate(tExpSmooth* const expsmooth, int controlRate)
+{
+    _tExpSmooth* smooth = *expsmooth;
+    smooth->controlRate = (controlRate > 0) ? controlRate : 0;
+}
+
 void    tExpSmooth_setSampleRate(tExpSmooth* const expsmooth, float sr)
 {
     _tExpSmooth* smooth = *expsmooth;
@@ -1411,6 +1951,11 @@ void    tSlide_initToPool    (tSlide* const sl, float upSlide, float downSlide,
     }
     s->invUpSlide = 1.0f / upSlide;
     s->invDownSlide = 1.0f / downSlide;
+    
+    s->controlRate = 0;
+    s->controlCount = 0;
+    s->controlValue = 0.0f;
+    s->controlInc = 0.0f;
 }
 
 void    tSlide_free  (tSlide* const sl)
@@ -1450,8 +1995,7 @@ float tSlide_tickNoInput(tSlide* const sl)
     {
         s->currentOut = s->prevOut + ((in - s->prevOut) * s->invDownSlide);
     }
-#ifdef NO_DENORMAL_CHECK
-#else
+#if !LEAF_NO_DENORMAL_CHECK
     if (s->currentOut < VSF) s->currentOut = 0.0f;
 #endif
     s->prevIn = in;
@@ -1472,8 +2016,7 @@ float tSlide_tick(tSlide* const sl, float in)
     {
         s->currentOut = s->prevOut + ((in - s->prevOut) * s->invDownSlide);
     }
-#ifdef NO_DENORMAL_CHECK
-#else
+#if !LEAF_NO_DENORMAL_CHECK
     if (s->currentOut < VSF) s->currentOut = 0.0f;
 #endif
     s->prevIn = in;
@@ -1481,3 +2024,36 @@ float tSlide_tick(tSlide* const sl, float in)
     return s->currentOut;
 }
 
+void    tSlide_tickBlock(tSlide* const sl, float* output, int numSamples)
+{
+    _tSlide* s = *sl;
+    int k = (s->controlRate > 0) ? s->controlRate : s->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (s->controlCount == 0)
+        {
+            // k ticks of tSlide_tickNoInput in closed form; the output can't pass dest, so the slide
+            // direction holds for the whole period
+            float in = s->dest;
+            float inv = (in >= s->prevOut) ? s->invUpSlide : s->invDownSlide;
+            s->currentOut = in + (s->prevOut - in) * powf(1.0f - inv, (float) k);
+#if !LEAF_NO_DENORMAL_CHECK
+            if (s->currentOut < VSF) s->currentOut = 0.0f;
+#endif
+            s->prevIn = in;
+            s->prevOut = s->currentOut;
+            float target = s->currentOut;
+            s->controlInc = (target - s->controlValue) / (float) k;
+            s->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &s->controlValue, s->controlInc, &s->controlCount);
+    }
+}
+
+void    tSlide_setControlRate(tSlide* const sl, int controlRate)
+{
+    _tSlide* s = *sl;
+    s->controlRate = (controlRate > 0) ? controlRate : 0;
+}
+
@@ -810,7 +810,7 @@ void    tSVF_initToPool     (tSVF* const svff, SVFType type, float freq, float Q
     svf->ic2eq = 0;
     svf->Q = Q;
     svf->cutoff = freq;
-    svf->g = tanf(PI * freq * svf->invSampleRate);
+    svf->g = LEAF_tanQuality(PI * freq * svf->invSampleRate, LEAF_QUALITY(leaf));
     svf->k = 1.0f/Q;
     svf->a1 = 1.0f/(1.0f + svf->g * (svf->g + svf->k));
     svf->a2 = svf->g*svf->a1;
@@ -886,7 +886,7 @@ void     tSVF_setFreq(tSVF* const svff, float freq)
     _tSVF* svf = *svff;
     
     svf->cutoff = LEAF_clip(0.0f, freq, svf->sampleRate * 0.5f);
-    svf->g = tanf(PI * svf->cutoff * svf->invSampleRate);
+    svf->g = LEAF_tanQuality(PI * svf->cutoff * svf->invSampleRate, LEAF_QUALITY(svf->mempool->leaf));
     svf->a1 = 1.0f/(1.0f + svf->g * (svf->g + svf->k));
     svf->a2 = svf->g * svf->a1;
     svf->a3 = svf->g * svf->a2;
@@ -921,7 +921,7 @@ void    tSVF_setFreqAndQ(tSVF* const svff, float freq, float Q)
     
     svf->cutoff = LEAF_clip(0.0f, freq, svf->sampleRate * 0.5f);
     svf->k = 1.0f/Q;
-    svf->g = tanf(PI * svf->cutoff * svf->invSampleRate);
+    svf->g = LEAF_tanQuality(PI * svf->cutoff * svf->invSampleRate, LEAF_QUALITY(svf->mempool->leaf));
     svf->a1 = 1.0f/(1.0f + svf->g * (svf->g + svf->k));
     svf->a2 = svf->g * svf->a1;
     svf->a3 = svf->g * svf->a2;
@@ -1376,7 +1376,8 @@ float   tVZFilter_tickEfficient             (tVZFilter* const vf, float in)
 void   tVZFilter_calcCoeffs           (tVZFilter* const vf)
 {
     _tVZFilter* f = *vf;
-    f->g = tanf(PI * f->fc * f->invSampleRate);  // embedded integrator gain (Fig 3.11)
+    LEAFQuality quality = LEAF_QUALITY(f->mempool->leaf);
+    f->g = LEAF_tanQuality(PI * f->fc * f->invSampleRate, quality);  // embedded integrator gain (Fig 3.11)
     
     switch( f->type )
     {
@@ -1428,8 +1429,8 @@ void   tVZFilter_calcCoeffs           (tVZFilter* const vf)
             break;
         case Bell:
         {
-            float fl = f->fc*powf(2.0f, (-f->B)*0.5f); // lower bandedge frequency (in Hz)
-            float wl = tanf(PI*fl*f->invSampleRate);   // warped radian lower bandedge frequency /(2*fs)
+            float fl = f->fc*LEAF_exp2Quality((-f->B)*0.5f, quality); // lower bandedge frequency (in Hz)
+            float wl = LEAF_tanQuality(PI*fl*f->invSampleRate, quality);   // warped radian lower bandedge frequency /(2*fs)
             float r  = f->g/wl;
             r *= r;    // warped frequency ratio wu/wl == (wc/wl)^2 where wu is the
             // warped upper bandedge, wc the center
@@ -1742,8 +1743,9 @@ void tVZFilter_setType              (tVZFilter* const vf, VZFilterType type)
 float tVZFilter_BandwidthToR(tVZFilter* const vf, float B)
 {
     _tVZFilter* f = *vf;
-    float fl = f->fc*powf(2.0f, -B*0.5f); // lower bandedge frequency (in Hz)
-    float gl = tanf(PI*fl*f->invSampleRate);   // warped radian lower bandedge frequency /(2*fs)
+    LEAFQuality quality = LEAF_QUALITY(f->mempool->leaf);
+    float fl = f->fc*LEAF_exp2Quality(-B*0.5f, quality); // lower bandedge frequency (in Hz)
+    float gl = LEAF_tanQuality(PI*fl*f->invSampleRate, quality);   // warped radian lower bandedge frequency /(2*fs)
     float r  = gl/f->g;            // ratio between warped lower bandedge- and center-frequencies
     // unwarped: r = pow(2, -B/2) -> approximation for low
     // center-frequencies
@@ -1789,7 +1791,7 @@ void    tDiodeFilter_initToPool     (tDiodeFilter* const vf, float cutoff, float
     f->invSampleRate = leaf->invSampleRate;
     f->cutoff = cutoff;
     // initialization (the resonance factor is between 0 and 8 according to the article)
-    f->f = (float)tan((double)(PI * cutoff * f->invSampleRate));
+    f->f = LEAF_tanQuality(PI * cutoff * f->invSampleRate, LEAF_QUALITY(leaf));
     f->r = (7.f * resonance + 0.5f);
     f->Vt = 0.5f;
     f->n = 1.836f;
@@ -1911,7 +1913,7 @@ float   tDiodeFilter_tick               (tDiodeFilter* const vf, float in)
     f->s3 += 2.0f * (-t4*(y3) - t3*(y3-y2));
     
     f->zi = in;
-    return tanhf(y3*f->r);
+    return LEAF_tanhQuality(y3*f->r, LEAF_QUALITY(f->mempool->leaf));
 }
 
 void    tDiodeFilter_setFreq     (tDiodeFilter* const vf, float cutoff)
@@ -1919,7 +1921,7 @@ void    tDiodeFilter_setFreq     (tDiodeFilter* const vf, float cutoff)
     _tDiodeFilter* f = *vf;
     
     f->cutoff = LEAF_clip(40.0f, cutoff, 18000.0f);
-    f->f = tanf(PI * f->cutoff * f->invSampleRate);
+    f->f = LEAF_tanQuality(PI * f->cutoff * f->invSampleRate, LEAF_QUALITY(f->mempool->leaf));
 }
 
 void    tDiodeFilter_setFreqFast     (tDiodeFilter* const vf, float cutoff)
@@ -1941,7 +1943,7 @@ void    tDiodeFilter_setSampleRate(tDiodeFilter* const vf, float sr)
     _tDiodeFilter* f = *vf;
     
     f->invSampleRate = 1.0f/sr;
-    f->f = tanf(PI * f->cutoff * f->invSampleRate);
+    f->f = LEAF_tanQuality(PI * f->cutoff * f->invSampleRate, LEAF_QUALITY(f->mempool->leaf));
 }
 
 
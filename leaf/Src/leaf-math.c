@@ -472,6 +472,78 @@ float   fast_tanh4 (float x)
     return (result);
 }
 
+float LEAF_tanQuality (float x, LEAFQuality quality)
+{
+#if LEAF_FIXED_QUALITY >= 0
+    quality = (LEAFQuality) LEAF_FIXED_QUALITY;
+#endif
+    if (quality == LEAFQualityBalanced)
+    {
+        // fasttanf() is exact to float precision up to pi/4, and tan(x) = 1/tan(pi/2 - x) above
+        float a = fabsf(x);
+        float t = (a <= PI * 0.25f) ? fasttanf(a) : 1.0f / fasttanf(HALF_PI - a);
+        return (x < 0.0f) ? -t : t;
+    }
+    if (quality == LEAFQualityFast)
+    {
+        // keep the pole of the Pade just past pi/2
+        float x2 = x * x;
+        if (x2 > 2.4674011f) x2 = 2.4674011f;
+        return x * (15.0f - x2) / (15.0f - 6.0f * x2);
+    }
+    return tanf(x);
+}
+
+float LEAF_tanhQuality (float x, LEAFQuality quality)
+{
+#if LEAF_FIXED_QUALITY >= 0
+    quality = (LEAFQuality) LEAF_FIXED_QUALITY;
+#endif
+    if (quality == LEAFQualityBalanced)
+    {
+        // tanh(x) = 1 - 2/(e^2x + 1), kept inside the range of fastexp2f()
+        if (x > 9.0f) x = 9.0f;
+        else if (x < -9.0f) x = -9.0f;
+        float e = fastexp2f(2.885390082f * x);
+        return 1.0f - 2.0f / (e + 1.0f);
+    }
+    if (quality == LEAFQualityFast)
+    {
+        // fast_tanh() reaches 1 at 4.97 and overshoots past it
+        if (x > 4.97f) x = 4.97f;
+        else if (x < -4.97f) x = -4.97f;
+        return fast_tanh(x);
+    }
+    return tanhf(x);
+}
+
+float LEAF_exp2Quality (float x, LEAFQuality quality)
+{
+#if LEAF_FIXED_QUALITY >= 0
+    quality = (LEAFQuality) LEAF_FIXED_QUALITY;
+#endif
+    if (quality == LEAFQualityHigh) return exp2f(x);
+    
+    if (x < -126.0f) x = -126.0f;
+    else if (x > 126.0f) x = 126.0f;
+    if (quality == LEAFQualityBalanced) return fastexp2f(x);
+    
+    union { float f; int32_t i; } bits;
+    int32_t k = (int32_t)(x + 4096.0f) - 4096;
+    float f = x - (float)k;
+    bits.f = 1.0f + f * (0.6951786f + f * (0.2261697f + f * 0.0780425f));
+    bits.i += (int32_t)((uint32_t)k << 23);
+    return bits.f;
+}
+
+float LEAF_expQuality (float x, LEAFQuality quality)
+{
+#if LEAF_FIXED_QUALITY >= 0
+    quality = (LEAFQuality) LEAF_FIXED_QUALITY;
+#endif
+    if (quality == LEAFQualityHigh) return expf(x);
+    return LEAF_exp2Quality(x * 1.442695041f, quality);
+}
 
 void LEAF_generate_sine(float* buffer, int size)
 {
@@ -737,6 +809,25 @@ float LEAF_interpolation_linear (float A, float B, float alpha)
     return out;
 }
 
+// Used by the control-rate tickBlock functions of envelopes and LFOs. At each control
+// point the caller sets inc to (target - *value) / controlRate and *count to controlRate;
+// since the next period starts from wherever this one landed, rounding doesn't accumulate.
+int LEAF_controlRamp (float* output, int numSamples, float* value, float inc, int* count)
+{
+    int n = (*count < numSamples) ? *count : numSamples;
+    float v = *value;
+    
+    for (int i = 0; i < n; i++)
+    {
+        v += inc;
+        output[i] = v;
+    }
+    
+    *value = v;
+    *count -= n;
+    return n;
+}
+
 #define LOGTEN 2.302585092994
 
 float mtof(float f)
@@ -864,6 +955,18 @@ float median3f(float a, float b, float c)
     return fmax(fmin(a, b), fmin(fmax(a, b), c));
 }
 
+uint32_t LEAF_nextPowerOfTwo(uint32_t x)
+{
+    if (x <= 1) return 1;
+    x--;
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+    return x + 1;
+}
+
 #if LEAF_INCLUDE_MINBLEP_TABLES
 /// MINBLEPS
 // https://github.com/MrBlueXav/Dekrispator_v2 blepvco.c
@@ -912,3 +1015,269 @@ void place_slope_dd(float *buffer, int index, float phase, float w, float slope_
 #endif // LEAF_INCLUDE_MINBLEP_TABLES
     /*! @} */
 
+//==============================================================================
+// Block math
+//
+// Each kernel is written once against a handful of vector operations, which
+// are SSE2 or AVX2 intrinsics when the compiler targets them (NEON only with
+// LEAF_USE_NEON, until it has been checked on hardware) and plain floats otherwise. The last partial vector of a block is run through a
+// zero-padded copy so every element goes through the same arithmetic.
+//==============================================================================
+
+#if LEAF_USE_SIMD && defined(__AVX2__)
+
+#include <immintrin.h>
+#define LEAF_SIMD_WIDTH 8
+typedef __m256 leaf_vf;
+typedef __m256i leaf_vi;
+
+static inline leaf_vf leafv_set(float a)                    { return _mm256_set1_ps(a); }
+static inline leaf_vf leafv_load(const float* p)            { return _mm256_loadu_ps(p); }
+static inline void    leafv_store(float* p, leaf_vf a)      { _mm256_storeu_ps(p, a); }
+static inline leaf_vf leafv_add(leaf_vf a, leaf_vf b)       { return _mm256_add_ps(a, b); }
+static inline leaf_vf leafv_sub(leaf_vf a, leaf_vf b)       { return _mm256_sub_ps(a, b); }
+static inline leaf_vf leafv_mul(leaf_vf a, leaf_vf b)       { return _mm256_mul_ps(a, b); }
+static inline leaf_vf leafv_div(leaf_vf a, leaf_vf b)       { return _mm256_div_ps(a, b); }
+static inline leaf_vf leafv_min(leaf_vf a, leaf_vf b)       { return _mm256_min_ps(a, b); }
+static inline leaf_vf leafv_max(leaf_vf a, leaf_vf b)       { return _mm256_max_ps(a, b); }
+static inline leaf_vi leafv_toint(leaf_vf a)                { return _mm256_cvttps_epi32(a); }
+static inline leaf_vf leafv_tofloat(leaf_vi a)              { return _mm256_cvtepi32_ps(a); }
+static inline leaf_vi leafv_iadd(leaf_vi a, int32_t b)      { return _mm256_add_epi32(a, _mm256_set1_epi32(b)); }
+static inline leaf_vi leafv_iand(leaf_vi a, int32_t b)      { return _mm256_and_si256(a, _mm256_set1_epi32(b)); }
+static inline leaf_vi leafv_ior(leaf_vi a, int32_t b)       { return _mm256_or_si256(a, _mm256_set1_epi32(b)); }
+static inline leaf_vi leafv_shl23(leaf_vi a)                { return _mm256_slli_epi32(a, 23); }
+static inline leaf_vi leafv_shr23(leaf_vi a)                { return _mm256_srli_epi32(a, 23); }
+static inline leaf_vi leafv_asint(leaf_vf a)                { return _mm256_castps_si256(a); }
+static inline leaf_vf leafv_asfloat(leaf_vi a)              { return _mm256_castsi256_ps(a); }
+
+#elif LEAF_USE_SIMD && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+#include <emmintrin.h>
+#define LEAF_SIMD_WIDTH 4
+typedef __m128 leaf_vf;
+typedef __m128i leaf_vi;
+
+static inline leaf_vf leafv_set(float a)                    { return _mm_set1_ps(a); }
+static inline leaf_vf leafv_load(const float* p)            { return _mm_loadu_ps(p); }
+static inline void    leafv_store(float* p, leaf_vf a)      { _mm_storeu_ps(p, a); }
+static inline leaf_vf leafv_add(leaf_vf a, leaf_vf b)       { return _mm_add_ps(a, b); }
+static inline leaf_vf leafv_sub(leaf_vf a, leaf_vf b)       { return _mm_sub_ps(a, b); }
+static inline leaf_vf leafv_mul(leaf_vf a, leaf_vf b)       { return _mm_mul_ps(a, b); }
+static inline leaf_vf leafv_div(leaf_vf a, leaf_vf b)       { return _mm_div_ps(a, b); }
+static inline leaf_vf leafv_min(leaf_vf a, leaf_vf b)       { return _mm_min_ps(a, b); }
+static inline leaf_vf leafv_max(leaf_vf a, leaf_vf b)       { return _mm_max_ps(a, b); }
+static inline leaf_vi leafv_toint(leaf_vf a)                { return _mm_cvttps_epi32(a); }
+static inline leaf_vf leafv_tofloat(leaf_vi a)              { return _mm_cvtepi32_ps(a); }
+static inline leaf_vi leafv_iadd(leaf_vi a, int32_t b)      { return _mm_add_epi32(a, _mm_set1_epi32(b)); }
+static inline leaf_vi leafv_iand(leaf_vi a, int32_t b)      { return _mm_and_si128(a, _mm_set1_epi32(b)); }
+static inline leaf_vi leafv_ior(leaf_vi a, int32_t b)       { return _mm_or_si128(a, _mm_set1_epi32(b)); }
+static inline leaf_vi leafv_shl23(leaf_vi a)                { return _mm_slli_epi32(a, 23); }
+static inline leaf_vi leafv_shr23(leaf_vi a)                { return _mm_srli_epi32(a, 23); }
+static inline leaf_vi leafv_asint(leaf_vf a)                { return _mm_castps_si128(a); }
+static inline leaf_vf leafv_asfloat(leaf_vi a)              { return _mm_castsi128_ps(a); }
+
+#elif LEAF_USE_SIMD && LEAF_USE_NEON && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+#include <arm_neon.h>
+#define LEAF_SIMD_WIDTH 4
+typedef float32x4_t leaf_vf;
+typedef int32x4_t leaf_vi;
+
+static inline leaf_vf leafv_set(float a)                    { return vdupq_n_f32(a); }
+static inline leaf_vf leafv_load(const float* p)            { return vld1q_f32(p); }
+static inline void    leafv_store(float* p, leaf_vf a)      { vst1q_f32(p, a); }
+static inline leaf_vf leafv_add(leaf_vf a, leaf_vf b)       { return vaddq_f32(a, b); }
+static inline leaf_vf leafv_sub(leaf_vf a, leaf_vf b)       { return vsubq_f32(a, b); }
+static inline leaf_vf leafv_mul(leaf_vf a, leaf_vf b)       { return vmulq_f32(a, b); }
+#if defined(__aarch64__)
+static inline leaf_vf leafv_div(leaf_vf a, leaf_vf b)       { return vdivq_f32(a, b); }
+#else
+// no divide before AArch64: a reciprocal estimate and two Newton steps
+static inline leaf_vf leafv_div(leaf_vf a, leaf_vf b)
+{
+    leaf_vf r = vrecpeq_f32(b);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    r = vmulq_f32(vrecpsq_f32(b, r), r);
+    return vmulq_f32(a, r);
+}
+#endif
+static inline leaf_vf leafv_min(leaf_vf a, leaf_vf b)       { return vminq_f32(a, b); }
+static inline leaf_vf leafv_max(leaf_vf a, leaf_vf b)       { return vmaxq_f32(a, b); }
+static inline leaf_vi leafv_toint(leaf_vf a)                { return vcvtq_s32_f32(a); }
+static inline leaf_vf leafv_tofloat(leaf_vi a)              { return vcvtq_f32_s32(a); }
+static inline leaf_vi leafv_iadd(leaf_vi a, int32_t b)      { return vaddq_s32(a, vdupq_n_s32(b)); }
+static inline leaf_vi leafv_iand(leaf_vi a, int32_t b)      { return vandq_s32(a, vdupq_n_s32(b)); }
+static inline leaf_vi leafv_ior(leaf_vi a, int32_t b)       { return vorrq_s32(a, vdupq_n_s32(b)); }
+static inline leaf_vi leafv_shl23(leaf_vi a)                { return vshlq_n_s32(a, 23); }
+static inline leaf_vi leafv_shr23(leaf_vi a)                { return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a), 23)); }
+static inline leaf_vi leafv_asint(leaf_vf a)                { return vreinterpretq_s32_f32(a); }
+static inline leaf_vf leafv_asfloat(leaf_vi a)              { return vreinterpretq_f32_s32(a); }
+
+#else
+
+#define LEAF_SIMD_WIDTH 1
+typedef float leaf_vf;
+typedef int32_t leaf_vi;
+
+static inline leaf_vf leafv_set(float a)                    { return a; }
+static inline leaf_vf leafv_load(const float* p)            { return *p; }
+static inline void    leafv_store(float* p, leaf_vf a)      { *p = a; }
+static inline leaf_vf leafv_add(leaf_vf a, leaf_vf b)       { return a + b; }
+static inline leaf_vf leafv_sub(leaf_vf a, leaf_vf b)       { return a - b; }
+static inline leaf_vf leafv_mul(leaf_vf a, leaf_vf b)       { return a * b; }
+static inline leaf_vf leafv_div(leaf_vf a, leaf_vf b)       { return a / b; }
+static inline leaf_vf leafv_min(leaf_vf a, leaf_vf b)       { return (a < b) ? a : b; }
+static inline leaf_vf leafv_max(leaf_vf a, leaf_vf b)       { return (a > b) ? a : b; }
+static inline leaf_vi leafv_toint(leaf_vf a)                { return (int32_t) a; }
+static inline leaf_vf leafv_tofloat(leaf_vi a)              { return (float) a; }
+static inline leaf_vi leafv_iadd(leaf_vi a, int32_t b)      { return a + b; }
+static inline leaf_vi leafv_iand(leaf_vi a, int32_t b)      { return a & b; }
+static inline leaf_vi leafv_ior(leaf_vi a, int32_t b)       { return a | b; }
+static inline leaf_vi leafv_shl23(leaf_vi a)                { return (int32_t) ((uint32_t) a << 23); }
+static inline leaf_vi leafv_shr23(leaf_vi a)                { return (int32_t) ((uint32_t) a >> 23); }
+static inline leaf_vi leafv_asint(leaf_vf a)                { union { float f; int32_t i; } u = { a }; return u.i; }
+static inline leaf_vf leafv_asfloat(leaf_vi a)              { union { int32_t i; float f; } u = { a }; return u.f; }
+
+#endif
+
+static inline leaf_vf leafv_clip(leaf_vf x, float lo, float hi)
+{
+    return leafv_min(leafv_max(x, leafv_set(lo)), leafv_set(hi));
+}
+
+// fastexp2f(), for x clipped to [-126, 126]
+static inline leaf_vf leafv_exp2(leaf_vf x)
+{
+    x = leafv_clip(x, -126.0f, 126.0f);
+    leaf_vi i = leafv_iadd(leafv_toint(leafv_add(x, leafv_set(4096.0f))), -4096);
+    leaf_vf f = leafv_sub(x, leafv_tofloat(i));
+    leaf_vf p = leafv_mul(f, leafv_set(0.01355574723481f));
+    p = leafv_mul(f, leafv_add(p, leafv_set(0.05203236900844f)));
+    p = leafv_mul(f, leafv_add(p, leafv_set(0.24137976293709f)));
+    p = leafv_mul(f, leafv_add(p, leafv_set(0.69303212081966f)));
+    p = leafv_add(p, leafv_set(1.0f));
+    return leafv_mul(p, leafv_asfloat(leafv_shl23(leafv_iadd(i, 127))));
+}
+
+// log2f_approx(), reading the exponent and mantissa from the bits
+static inline leaf_vf leafv_log2(leaf_vf x)
+{
+    leaf_vi bits = leafv_asint(x);
+    leaf_vf e = leafv_tofloat(leafv_iadd(leafv_iand(leafv_shr23(bits), 0xFF), -126));
+    leaf_vf f = leafv_asfloat(leafv_ior(leafv_iand(bits, 0x007FFFFF), 0x3F000000));
+    leaf_vf y = leafv_mul(f, leafv_set(1.23149591368684f));
+    y = leafv_mul(f, leafv_add(y, leafv_set(-4.11852516267426f)));
+    y = leafv_mul(f, leafv_add(y, leafv_set(6.02197014179219f)));
+    y = leafv_add(y, leafv_set(-3.13396450166353f));
+    return leafv_add(y, e);
+}
+
+static inline leaf_vf leafv_dbtoa(leaf_vf x)
+{
+    return leafv_exp2(leafv_mul(x, leafv_set(0.166096404744368f)));
+}
+
+static inline leaf_vf leafv_atodb(leaf_vf x)
+{
+    return leafv_mul(leafv_log2(x), leafv_set(6.02059991327962f));
+}
+
+static inline leaf_vf leafv_mtof(leaf_vf x)
+{
+    x = leafv_clip(x, -1500.0f, 1499.0f);
+    return leafv_mul(leafv_exp2(leafv_mul(x, leafv_set(0.0833333333333f))), leafv_set(8.17579891564f));
+}
+
+// LEAF_tanh(), which meets +-1 exactly at +-3
+static inline leaf_vf leafv_tanh(leaf_vf x)
+{
+    x = leafv_clip(x, -3.0f, 3.0f);
+    leaf_vf x2 = leafv_mul(x, x);
+    leaf_vf num = leafv_mul(x, leafv_add(x2, leafv_set(27.0f)));
+    leaf_vf den = leafv_add(leafv_mul(x2, leafv_set(9.0f)), leafv_set(27.0f));
+    return leafv_div(num, den);
+}
+
+// fastcosf()
+static inline leaf_vf leafv_cos(leaf_vf x)
+{
+    leaf_vf x2 = leafv_mul(x, x);
+    leaf_vf y = leafv_mul(x2, leafv_set(-2.605e-07f));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(2.47609e-05f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(-1.3888397e-03f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(4.16666418e-02f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(-4.999999963e-01f)));
+    return leafv_add(y, leafv_set(1.0f));
+}
+
+// fasttanf()
+static inline leaf_vf leafv_tan(leaf_vf x)
+{
+    leaf_vf x2 = leafv_mul(x, x);
+    leaf_vf y = leafv_mul(x2, leafv_set(9.5168091e-03f));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(2.900525e-03f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(2.45650893e-02f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(5.33740603e-02f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(1.333923995e-01f)));
+    y = leafv_mul(x2, leafv_add(y, leafv_set(3.333314036e-01f)));
+    return leafv_mul(x, leafv_add(y, leafv_set(1.0f)));
+}
+
+static inline void leafBlockApply(leaf_vf (*kernel)(leaf_vf), const float* in, float* out, int n)
+{
+    int i = 0;
+    for (; i + LEAF_SIMD_WIDTH <= n; i += LEAF_SIMD_WIDTH)
+        leafv_store(&out[i], kernel(leafv_load(&in[i])));
+    
+    if (i < n)
+    {
+        float tmp[LEAF_SIMD_WIDTH] = { 0.0f };
+        for (int j = 0; i + j < n; j++) tmp[j] = in[i + j];
+        leafv_store(tmp, kernel(leafv_load(tmp)));
+        for (int j = 0; i + j < n; j++) out[i + j] = tmp[j];
+    }
+}
+
+void LEAF_exp2_block (const float* in, float* out, int n)      { leafBlockApply(leafv_exp2, in, out, n); }
+void LEAF_log2_block (const float* in, float* out, int n)      { leafBlockApply(leafv_log2, in, out, n); }
+void LEAF_dbtoa_block (const float* in, float* out, int n)     { leafBlockApply(leafv_dbtoa, in, out, n); }
+void LEAF_atodb_block (const float* in, float* out, int n)     { leafBlockApply(leafv_atodb, in, out, n); }
+void LEAF_mtof_block (const float* in, float* out, int n)      { leafBlockApply(leafv_mtof, in, out, n); }
+void LEAF_tanh_block (const float* in, float* out, int n)      { leafBlockApply(leafv_tanh, in, out, n); }
+void LEAF_cos_block (const float* in, float* out, int n)       { leafBlockApply(leafv_cos, in, out, n); }
+void LEAF_tan_block (const float* in, float* out, int n)       { leafBlockApply(leafv_tan, in, out, n); }
+
+static inline leaf_vf leafv_hermite(leaf_vf A, leaf_vf B, leaf_vf C, leaf_vf D, leaf_vf t)
+{
+    leaf_vf half = leafv_set(0.5f);
+    t = leafv_clip(t, 0.0f, 1.0f);
+    
+    // the same coefficients as LEAF_interpolate_hermite()
+    leaf_vf a = leafv_mul(leafv_add(leafv_sub(leafv_mul(leafv_sub(B, C), leafv_set(3.0f)), A), D), half);
+    leaf_vf b = leafv_sub(leafv_add(A, leafv_add(C, C)), leafv_mul(leafv_add(leafv_mul(B, leafv_set(5.0f)), D), half));
+    leaf_vf c = leafv_mul(leafv_sub(C, A), half);
+    
+    return leafv_add(leafv_mul(leafv_add(leafv_mul(leafv_add(leafv_mul(a, t), b), t), c), t), B);
+}
+
+void LEAF_interpolate_hermite_block (const float* A, const float* B, const float* C, const float* D, const float* alpha, float* out, int n)
+{
+    int i = 0;
+    for (; i + LEAF_SIMD_WIDTH <= n; i += LEAF_SIMD_WIDTH)
+        leafv_store(&out[i], leafv_hermite(leafv_load(&A[i]), leafv_load(&B[i]), leafv_load(&C[i]), leafv_load(&D[i]), leafv_load(&alpha[i])));
+    
+    if (i < n)
+    {
+        float tmp[5][LEAF_SIMD_WIDTH] = { { 0.0f } };
+        for (int j = 0; i + j < n; j++)
+        {
+            tmp[0][j] = A[i + j];
+            tmp[1][j] = B[i + j];
+            tmp[2][j] = C[i + j];
+            tmp[3][j] = D[i + j];
+            tmp[4][j] = alpha[i + j];
+        }
+        leafv_store(tmp[0], leafv_hermite(leafv_load(tmp[0]), leafv_load(tmp[1]), leafv_load(tmp[2]), leafv_load(tmp[3]), leafv_load(tmp[4])));
+        for (int j = 0; i + j < n; j++) out[i + j] = tmp[0][j];
+    }
+}
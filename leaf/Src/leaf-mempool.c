@@ -164,6 +164,13 @@ char* mpool_alloc(size_t asize, _tMempool* pool)
                                node_to_alloc->next,
                                node_to_alloc->prev,
                                leftover - pool->leaf->header_size, pool->leaf->header_size);
+        
+        // Splice the new node into the free list in place of the allocated one,
+        // so no free node is left pointing at allocated space
+        if (new_node->next != NULL) new_node->next->prev = new_node;
+        if (new_node->prev != NULL) new_node->prev->next = new_node;
+        node_to_alloc->next = NULL;
+        node_to_alloc->prev = NULL;
     }
     else
     {
@@ -171,6 +178,9 @@ char* mpool_alloc(size_t asize, _tMempool* pool)
         node_to_alloc->size += leftover;
         
         new_node = node_to_alloc->next;
+        
+        // Remove the allocated node from the free list
+        delink_node(node_to_alloc);
     }
     
     // Update the head if we are allocating the first node of the free list
@@ -180,9 +190,6 @@ char* mpool_alloc(size_t asize, _tMempool* pool)
         pool->head = new_node;
     }
     
-    // Remove the allocated node from the free list
-    delink_node(node_to_alloc);
-    
     pool->usize += pool->leaf->header_size + node_to_alloc->size;
     
     if (pool->leaf->clearOnAllocation > 0)
@@ -268,6 +275,13 @@ char* mpool_calloc(size_t asize, _tMempool* pool)
                                node_to_alloc->next,
                                node_to_alloc->prev,
                                leftover - pool->leaf->header_size, pool->leaf->header_size);
+        
+        // Splice the new node into the free list in place of the allocated one,
+        // so no free node is left pointing at allocated space
+        if (new_node->next != NULL) new_node->next->prev = new_node;
+        if (new_node->prev != NULL) new_node->prev->next = new_node;
+        node_to_alloc->next = NULL;
+        node_to_alloc->prev = NULL;
     }
     else
     {
@@ -275,6 +289,9 @@ char* mpool_calloc(size_t asize, _tMempool* pool)
         node_to_alloc->size += leftover;
         
         new_node = node_to_alloc->next;
+        
+        // Remove the allocated node from the free list
+        delink_node(node_to_alloc);
     }
     
     // Update the head if we are allocating the first node of the free list
@@ -284,9 +301,6 @@ char* mpool_calloc(size_t asize, _tMempool* pool)
         pool->head = new_node;
     }
     
-    // Remove the allocated node from the free list
-    delink_node(node_to_alloc);
-    
     pool->usize += pool->leaf->header_size + node_to_alloc->size;
     // Format the new pool
     for (int i = 0; i < node_to_alloc->size; i++) node_to_alloc->pool[i] = 0;
@@ -373,6 +387,7 @@ void mpool_free(char* ptr, _tMempool* pool)
     }
     
     // Ensure the freed node is attached to the head
+    freed_node->prev = NULL;
     freed_node->next = pool->head;
     if (pool->head != NULL) pool->head->prev = freed_node;
     pool->head = freed_node;
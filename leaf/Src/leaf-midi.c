@@ -903,3 +903,689 @@ int tSimplePoly_isOn(tSimplePoly* const polyh, uint8_t voice)
     _tSimplePoly* poly = *polyh;
     return (poly->voices[voice][0] > 0) ? 1 : 0;
 }
+
+//==============================================================================
+
+void tVoiceAllocator_init(tVoiceAllocator* const va, int maxNumVoices, LEAF* const leaf)
+{
+    tVoiceAllocator_initToPool(va, maxNumVoices, &leaf->mempool);
+}
+
+void tVoiceAllocator_initToPool(tVoiceAllocator* const va, int maxNumVoices, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tVoiceAllocator* a = *va = (_tVoiceAllocator*) mpool_alloc(sizeof(_tVoiceAllocator), m);
+    a->mempool = m;
+    
+    if (maxNumVoices < 1) maxNumVoices = 1;
+    a->maxNumVoices = maxNumVoices;
+    a->numVoices = maxNumVoices;
+    a->numWords = (maxNumVoices + 31) / 32;
+    
+    a->voiceNote = (int*) mpool_alloc(sizeof(int) * maxNumVoices * 2, m);
+    a->voiceVel = a->voiceNote + maxNumVoices;
+    a->freeVoices = (uint32_t*) mpool_alloc(sizeof(uint32_t) * a->numWords, m);
+    
+    tVoiceAllocator_clear(va);
+}
+
+void tVoiceAllocator_free(tVoiceAllocator* const va)
+{
+    _tVoiceAllocator* a = *va;
+    
+    mpool_free((char*)a->freeVoices, a->mempool);
+    mpool_free((char*)a->voiceNote, a->mempool);
+    mpool_free((char*)a, a->mempool);
+}
+
+void tVoiceAllocator_clear(tVoiceAllocator* const va)
+{
+    _tVoiceAllocator* a = *va;
+    
+    for (int i = 0; i < a->maxNumVoices; i++)
+    {
+        a->voiceNote[i] = -1;
+        a->voiceVel[i] = 0;
+    }
+    for (int i = 0; i < a->numWords; i++) a->freeVoices[i] = 0xFFFFFFFF;
+    for (int i = 0; i < 128; i++)
+    {
+        a->noteVoice[i] = -1;
+        a->noteVel[i] = 0;
+        a->noteHeld[i] = 0;
+        a->notePrev[i] = -1;
+        a->noteNext[i] = -1;
+    }
+    a->oldest = -1;
+    a->newest = -1;
+    a->firstVoiced = -1;
+    a->numHeld = 0;
+    a->numActiveVoices = 0;
+    a->lastVoiceToChange = 0;
+}
+
+// Lowest free voice below numVoices, or -1
+static int voiceAllocatorFindFree(_tVoiceAllocator* a)
+{
+    static const uint8_t debruijn[32] =
+    {
+        0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+        31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+    };
+    
+    for (int w = 0; w * 32 < a->numVoices; w++)
+    {
+        uint32_t bits = a->freeVoices[w];
+        int left = a->numVoices - w * 32;
+        if (left < 32) bits &= (1u << left) - 1u;
+        if (bits) return w * 32 + debruijn[((bits & (0u - bits)) * 0x077CB531u) >> 27];
+    }
+    return -1;
+}
+
+static void voiceAllocatorAssign(_tVoiceAllocator* a, int voice, int note)
+{
+    a->voiceNote[voice] = note;
+    a->voiceVel[voice] = a->noteVel[note];
+    a->noteVoice[note] = voice;
+    a->lastVoiceToChange = voice;
+}
+
+int tVoiceAllocator_noteOn(tVoiceAllocator* const va, int note, uint8_t vel)
+{
+    _tVoiceAllocator* a = *va;
+    
+    if (note < 0 || note > 127 || a->noteHeld[note]) return -1;
+    
+    a->noteHeld[note] = 1;
+    a->noteVel[note] = vel;
+    a->notePrev[note] = a->newest;
+    a->noteNext[note] = -1;
+    if (a->newest >= 0) a->noteNext[a->newest] = note;
+    else a->oldest = note;
+    a->newest = note;
+    a->numHeld++;
+    
+    int voice = voiceAllocatorFindFree(a);
+    if (voice >= 0)
+    {
+        a->freeVoices[voice >> 5] &= ~(1u << (voice & 31));
+        a->numActiveVoices++;
+        if (a->firstVoiced < 0) a->firstVoiced = note;
+    }
+    else
+    {
+        // steal from the oldest sounding note, which joins the end of the waiting notes
+        int stolen = a->firstVoiced;
+        if (stolen < 0 || stolen == note) return -1;
+        voice = a->noteVoice[stolen];
+        a->noteVoice[stolen] = -1;
+        a->firstVoiced = a->noteNext[stolen];
+    }
+    
+    voiceAllocatorAssign(a, voice, note);
+    return voice;
+}
+
+int tVoiceAllocator_noteOff(tVoiceAllocator* const va, int note)
+{
+    _tVoiceAllocator* a = *va;
+    
+    if (note < 0 || note > 127 || !a->noteHeld[note]) return -1;
+    
+    int voice = a->noteVoice[note];
+    if (a->firstVoiced == note) a->firstVoiced = a->noteNext[note];
+    
+    if (a->notePrev[note] >= 0) a->noteNext[a->notePrev[note]] = a->noteNext[note];
+    else a->oldest = a->noteNext[note];
+    if (a->noteNext[note] >= 0) a->notePrev[a->noteNext[note]] = a->notePrev[note];
+    else a->newest = a->notePrev[note];
+    
+    a->noteHeld[note] = 0;
+    a->noteVel[note] = 0;
+    a->noteVoice[note] = -1;
+    a->numHeld--;
+    
+    if (voice < 0) return -1;
+    
+    a->voiceNote[voice] = -1;
+    a->voiceVel[voice] = 0;
+    a->lastVoiceToChange = voice;
+    
+    // hand the voice to the most recent waiting note, which is just before the sounding ones
+    int waiting = (a->firstVoiced >= 0) ? a->notePrev[a->firstVoiced] : a->newest;
+    if (waiting >= 0)
+    {
+        voiceAllocatorAssign(a, voice, waiting);
+        a->firstVoiced = waiting;
+        return -1;
+    }
+    
+    a->freeVoices[voice >> 5] |= 1u << (voice & 31);
+    a->numActiveVoices--;
+    return voice;
+}
+
+int tVoiceAllocator_getVoice(tVoiceAllocator* const va, int note)
+{
+    _tVoiceAllocator* a = *va;
+    if (note < 0 || note > 127) return -1;
+    return a->noteVoice[note];
+}
+
+int tVoiceAllocator_getKey(tVoiceAllocator* const va, int voice)
+{
+    _tVoiceAllocator* a = *va;
+    return a->voiceNote[voice];
+}
+
+int tVoiceAllocator_getVelocity(tVoiceAllocator* const va, int voice)
+{
+    _tVoiceAllocator* a = *va;
+    return a->voiceVel[voice];
+}
+
+int tVoiceAllocator_isOn(tVoiceAllocator* const va, int voice)
+{
+    _tVoiceAllocator* a = *va;
+    return (a->voiceNote[voice] >= 0) ? 1 : 0;
+}
+
+int tVoiceAllocator_getLastVoiceToChange(tVoiceAllocator* const va)
+{
+    _tVoiceAllocator* a = *va;
+    return a->lastVoiceToChange;
+}
+
+int tVoiceAllocator_getNumActiveVoices(tVoiceAllocator* const va)
+{
+    _tVoiceAllocator* a = *va;
+    return a->numActiveVoices;
+}
+
+int tVoiceAllocator_getNumHeldNotes(tVoiceAllocator* const va)
+{
+    _tVoiceAllocator* a = *va;
+    return a->numHeld;
+}
+
+void tVoiceAllocator_setNumVoices(tVoiceAllocator* const va, int numVoices)
+{
+    _tVoiceAllocator* a = *va;
+    if (numVoices < 0) numVoices = 0;
+    a->numVoices = (numVoices > a->maxNumVoices) ? a->maxNumVoices : numVoices;
+}
+
+int tVoiceAllocator_getNumVoices(tVoiceAllocator* const va)
+{
+    _tVoiceAllocator* a = *va;
+    return a->numVoices;
+}
+
+//==============================================================================
+
+void tMidiScheduler_init(tMidiScheduler* const sched, int maxNumEvents, LEAF* const leaf)
+{
+    tMidiScheduler_initToPool(sched, maxNumEvents, &leaf->mempool);
+}
+
+void tMidiScheduler_initToPool(tMidiScheduler* const sched, int maxNumEvents, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tMidiScheduler* s = *sched = (_tMidiScheduler*) mpool_alloc(sizeof(_tMidiScheduler), m);
+    s->mempool = m;
+    
+    if (maxNumEvents < 1) maxNumEvents = 1;
+    s->maxNumEvents = maxNumEvents;
+    s->numEvents = 0;
+    s->events = (tMidiEvent*) mpool_alloc(sizeof(tMidiEvent) * maxNumEvents, m);
+    
+    s->poly = NULL;
+    s->simplePoly = NULL;
+    s->numCallbacks = 0;
+}
+
+void tMidiScheduler_free(tMidiScheduler* const sched)
+{
+    _tMidiScheduler* s = *sched;
+    
+    mpool_free((char*)s->events, s->mempool);
+    mpool_free((char*)s, s->mempool);
+}
+
+int tMidiScheduler_addEvent(tMidiScheduler* const sched, tMidiEvent event)
+{
+    _tMidiScheduler* s = *sched;
+    
+    if (s->numEvents >= s->maxNumEvents) return 0;
+    if (event.offset < 0) event.offset = 0;
+    
+    // keep the queue sorted by offset, after any events already at the same offset
+    int i = s->numEvents;
+    while (i > 0 && s->events[i - 1].offset > event.offset)
+    {
+        s->events[i] = s->events[i - 1];
+        i--;
+    }
+    s->events[i] = event;
+    s->numEvents++;
+    return 1;
+}
+
+static int midiSchedulerAdd(tMidiScheduler* const sched, int offset, MidiEventType type, int channel, int data1, int data2, float value)
+{
+    tMidiEvent event;
+    event.offset = offset;
+    event.type = type;
+    event.channel = channel;
+    event.data1 = data1;
+    event.data2 = data2;
+    event.value = value;
+    return tMidiScheduler_addEvent(sched, event);
+}
+
+int tMidiScheduler_noteOn(tMidiScheduler* const sched, int offset, int channel, int note, int velocity)
+{
+    if (velocity == 0) return midiSchedulerAdd(sched, offset, MidiNoteOff, channel, note, 0, 0.0f);
+    return midiSchedulerAdd(sched, offset, MidiNoteOn, channel, note, velocity, 0.0f);
+}
+
+int tMidiScheduler_noteOff(tMidiScheduler* const sched, int offset, int channel, int note)
+{
+    return midiSchedulerAdd(sched, offset, MidiNoteOff, channel, note, 0, 0.0f);
+}
+
+int tMidiScheduler_controlChange(tMidiScheduler* const sched, int offset, int channel, int control, int value)
+{
+    return midiSchedulerAdd(sched, offset, MidiControlChange, channel, control, value, 0.0f);
+}
+
+int tMidiScheduler_pitchBend(tMidiScheduler* const sched, int offset, int channel, float pitchBend)
+{
+    return midiSchedulerAdd(sched, offset, MidiPitchBend, channel, 0, 0, pitchBend);
+}
+
+int tMidiScheduler_parameter(tMidiScheduler* const sched, int offset, int id, float value)
+{
+    return midiSchedulerAdd(sched, offset, MidiParameter, 0, id, 0, value);
+}
+
+void tMidiScheduler_setPoly(tMidiScheduler* const sched, tPoly* const poly)
+{
+    _tMidiScheduler* s = *sched;
+    s->poly = poly;
+}
+
+void tMidiScheduler_setSimplePoly(tMidiScheduler* const sched, tSimplePoly* const poly)
+{
+    _tMidiScheduler* s = *sched;
+    s->simplePoly = poly;
+}
+
+int tMidiScheduler_addCallback(tMidiScheduler* const sched, void (*callback)(void* userData, tMidiEvent* event, int voice), void* userData)
+{
+    _tMidiScheduler* s = *sched;
+    
+    if (s->numCallbacks >= MIDI_SCHEDULER_MAX_CALLBACKS) return 0;
+    s->callbacks[s->numCallbacks] = callback;
+    s->callbackData[s->numCallbacks] = userData;
+    s->numCallbacks++;
+    return 1;
+}
+
+static void midiSchedulerDispatch(_tMidiScheduler* s, tMidiEvent* event)
+{
+    int voice = -1;
+    
+    switch (event->type)
+    {
+        case MidiNoteOn:
+            if (s->simplePoly != NULL) voice = tSimplePoly_noteOn(s->simplePoly, event->data1, event->data2);
+            if (s->poly != NULL) voice = tPoly_noteOn(s->poly, event->data1, event->data2);
+            break;
+        case MidiNoteOff:
+            if (s->simplePoly != NULL) voice = tSimplePoly_noteOff(s->simplePoly, event->data1);
+            if (s->poly != NULL) voice = tPoly_noteOff(s->poly, event->data1);
+            break;
+        case MidiPitchBend:
+            if (s->poly != NULL) tPoly_setPitchBend(s->poly, event->value);
+            break;
+        default:
+            break;
+    }
+    
+    for (int i = 0; i < s->numCallbacks; i++)
+        s->callbacks[i](s->callbackData[i], event, voice);
+}
+
+void tMidiScheduler_processBlock(tMidiScheduler* const sched, int numSamples, void (*render)(void* userData, int offset, int numSamples), void* userData)
+{
+    _tMidiScheduler* s = *sched;
+    
+    int pos = 0;
+    int e = 0;
+    while (pos < numSamples)
+    {
+        while (e < s->numEvents && s->events[e].offset <= pos)
+        {
+            midiSchedulerDispatch(s, &s->events[e]);
+            e++;
+        }
+        
+        int end = (e < s->numEvents && s->events[e].offset < numSamples) ? s->events[e].offset : numSamples;
+        if (render != NULL) render(userData, pos, end - pos);
+        pos = end;
+    }
+    
+    // events past the end of the block move to the next one
+    int remaining = s->numEvents - e;
+    for (int i = 0; i < remaining; i++)
+    {
+        s->events[i] = s->events[e + i];
+        s->events[i].offset -= numSamples;
+    }
+    s->numEvents = remaining;
+}
+
+void tMidiScheduler_clear(tMidiScheduler* const sched)
+{
+    _tMidiScheduler* s = *sched;
+    s->numEvents = 0;
+}
+
+//==============================================================================
+
+void tMPEPoly_init(tMPEPoly* const mpe, int numVoices, LEAF* const leaf)
+{
+    tMPEPoly_initToPool(mpe, numVoices, &leaf->mempool);
+}
+
+void tMPEPoly_initToPool(tMPEPoly* const mpe, int numVoices, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tMPEPoly* p = *mpe = (_tMPEPoly*) mpool_alloc(sizeof(_tMPEPoly), m);
+    p->mempool = m;
+    LEAF* leaf = p->mempool->leaf;
+    
+    if (numVoices < 1) numVoices = 1;
+    p->numVoices = numVoices;
+    
+    p->params = (float*) mpool_alloc(sizeof(float) * numVoices * 6, m);
+    p->bend = p->params;
+    p->bendDest = p->bend + numVoices;
+    p->pressure = p->bendDest + numVoices;
+    p->pressureDest = p->pressure + numVoices;
+    p->slide = p->pressureDest + numVoices;
+    p->slideDest = p->slide + numVoices;
+    
+    p->voiceInfo = (int*) mpool_alloc(sizeof(int) * numVoices * 5, m);
+    p->note = p->voiceInfo;
+    p->velocity = p->note + numVoices;
+    p->channel = p->velocity + numVoices;
+    p->isOn = p->channel + numVoices;
+    p->age = p->isOn + numVoices;
+    
+    for (int i = 0; i < numVoices * 6; i++) p->params[i] = 0.0f;
+    for (int i = 0; i < numVoices; i++)
+    {
+        p->note[i] = -1;
+        p->velocity[i] = 0;
+        p->channel[i] = -1;
+        p->isOn[i] = 0;
+        p->age[i] = 0;
+    }
+    p->ageCounter = 0;
+    for (int c = 0; c < MPE_NUM_CHANNELS; c++)
+    {
+        p->channelVoice[c] = -1;
+        p->channelBend[c] = 0.0f;
+        p->channelPressure[c] = 0.0f;
+        p->channelSlide[c] = 0.0f;
+    }
+    
+    p->numLowerMembers = 15;
+    p->numUpperMembers = 0;
+    p->memberBendRange = 48.0f;
+    p->masterBendRange = 2.0f;
+    
+    p->sampleRate = leaf->sampleRate;
+    tMPEPoly_setSmoothTime(mpe, 5.0f);
+}
+
+void tMPEPoly_free(tMPEPoly* const mpe)
+{
+    _tMPEPoly* p = *mpe;
+    
+    mpool_free((char*)p->voiceInfo, p->mempool);
+    mpool_free((char*)p->params, p->mempool);
+    mpool_free((char*)p, p->mempool);
+}
+
+// the master channel whose bend applies to a channel, or -1
+static int mpeMasterOf(_tMPEPoly* p, int channel)
+{
+    if (channel >= 1 && channel <= p->numLowerMembers) return 0;
+    if (channel <= 14 && channel >= 15 - p->numUpperMembers) return 15;
+    return -1;
+}
+
+static int mpeIsMaster(_tMPEPoly* p, int channel)
+{
+    return (channel == 0 && p->numLowerMembers > 0) || (channel == 15 && p->numUpperMembers > 0);
+}
+
+static float mpeVoiceBend(_tMPEPoly* p, int channel)
+{
+    int master = mpeMasterOf(p, channel);
+    if (master < 0) return p->channelBend[channel];
+    return p->channelBend[channel] + p->channelBend[master];
+}
+
+void tMPEPoly_setZones(tMPEPoly* const mpe, int numLowerMembers, int numUpperMembers)
+{
+    _tMPEPoly* p = *mpe;
+    
+    p->numLowerMembers = numLowerMembers < 0 ? 0 : numLowerMembers > 15 ? 15 : numLowerMembers;
+    p->numUpperMembers = numUpperMembers < 0 ? 0 : numUpperMembers > 15 ? 15 : numUpperMembers;
+    // as with a configuration message, the lower zone gives way when the zones overlap
+    if (p->numLowerMembers + p->numUpperMembers > 14)
+    {
+        p->numLowerMembers = p->numUpperMembers > 0 ? 14 - p->numUpperMembers : 15;
+        // an upper zone of 15 members takes every channel below its master
+        if (p->numLowerMembers < 0) p->numLowerMembers = 0;
+    }
+    
+    for (int i = 0; i < p->numVoices; i++)
+        if (p->channel[i] >= 0) p->bendDest[i] = mpeVoiceBend(p, p->channel[i]);
+}
+
+void tMPEPoly_setPitchBendRange(tMPEPoly* const mpe, float memberRange, float masterRange)
+{
+    _tMPEPoly* p = *mpe;
+    p->memberBendRange = memberRange;
+    p->masterBendRange = masterRange;
+}
+
+void tMPEPoly_setSmoothTime(tMPEPoly* const mpe, float time)
+{
+    _tMPEPoly* p = *mpe;
+    
+    p->smoothTime = time;
+    if (time <= 0.0f) p->oneMinusFactor = 0.0f;
+    else p->oneMinusFactor = expf(-1000.0f / (time * p->sampleRate));
+    p->lastBlockSize = 0;
+}
+
+int tMPEPoly_noteOn(tMPEPoly* const mpe, int channel, int note, int velocity)
+{
+    _tMPEPoly* p = *mpe;
+    
+    if (channel < 0 || channel >= MPE_NUM_CHANNELS) return -1;
+    if (velocity <= 0) return tMPEPoly_noteOff(mpe, channel, note);
+    
+    // a channel plays one note at a time, so a new one takes over its voice
+    int voice = p->channelVoice[channel];
+    if (voice < 0)
+    {
+        // the free voice released longest ago, otherwise the held voice started longest ago
+        int oldestFree = -1, oldestHeld = -1;
+        for (int i = 0; i < p->numVoices; i++)
+        {
+            if (p->isOn[i])
+            {
+                if (oldestHeld < 0 || p->age[i] < p->age[oldestHeld]) oldestHeld = i;
+            }
+            else if (oldestFree < 0 || p->age[i] < p->age[oldestFree]) oldestFree = i;
+        }
+        voice = oldestFree >= 0 ? oldestFree : oldestHeld;
+        
+        if (p->channel[voice] >= 0) p->channelVoice[p->channel[voice]] = -1;
+        p->channel[voice] = channel;
+        p->channelVoice[channel] = voice;
+    }
+    
+    p->note[voice] = note;
+    p->velocity[voice] = velocity;
+    p->isOn[voice] = 1;
+    p->age[voice] = ++p->ageCounter;
+    
+    // expression sent before the note on belongs to it, so start there without smoothing
+    p->bend[voice] = p->bendDest[voice] = mpeVoiceBend(p, channel);
+    p->pressure[voice] = p->pressureDest[voice] = p->channelPressure[channel];
+    p->slide[voice] = p->slideDest[voice] = p->channelSlide[channel];
+    
+    return voice;
+}
+
+int tMPEPoly_noteOff(tMPEPoly* const mpe, int channel, int note)
+{
+    _tMPEPoly* p = *mpe;
+    
+    if (channel < 0 || channel >= MPE_NUM_CHANNELS) return -1;
+    
+    int voice = p->channelVoice[channel];
+    if (voice < 0 || !p->isOn[voice] || p->note[voice] != note) return -1;
+    
+    p->isOn[voice] = 0;
+    p->age[voice] = ++p->ageCounter;
+    
+    // pressure returns to zero for the next note on this channel
+    p->channelPressure[channel] = 0.0f;
+    
+    return voice;
+}
+
+void tMPEPoly_pitchBend(tMPEPoly* const mpe, int channel, int value)
+{
+    _tMPEPoly* p = *mpe;
+    
+    if (channel < 0 || channel >= MPE_NUM_CHANNELS) return;
+    
+    float range = mpeIsMaster(p, channel) ? p->masterBendRange : p->memberBendRange;
+    p->channelBend[channel] = (float)(value - 8192) * (1.0f / 8192.0f) * range;
+    
+    if (mpeIsMaster(p, channel))
+    {
+        for (int i = 0; i < p->numVoices; i++)
+            if (p->channel[i] >= 0 && mpeMasterOf(p, p->channel[i]) == channel)
+                p->bendDest[i] = mpeVoiceBend(p, p->channel[i]);
+    }
+    else if (p->channelVoice[channel] >= 0)
+        p->bendDest[p->channelVoice[channel]] = mpeVoiceBend(p, channel);
+}
+
+void tMPEPoly_pressure(tMPEPoly* const mpe, int channel, int value)
+{
+    _tMPEPoly* p = *mpe;
+    
+    if (channel < 0 || channel >= MPE_NUM_CHANNELS) return;
+    
+    p->channelPressure[channel] = LEAF_clip(0.0f, value * (1.0f / 127.0f), 1.0f);
+    if (p->channelVoice[channel] >= 0)
+        p->pressureDest[p->channelVoice[channel]] = p->channelPressure[channel];
+}
+
+void tMPEPoly_controlChange(tMPEPoly* const mpe, int channel, int control, int value)
+{
+    _tMPEPoly* p = *mpe;
+    
+    if (channel < 0 || channel >= MPE_NUM_CHANNELS || control != 74) return;
+    
+    p->channelSlide[channel] = LEAF_clip(0.0f, value * (1.0f / 127.0f), 1.0f);
+    if (p->channelVoice[channel] >= 0)
+        p->slideDest[p->channelVoice[channel]] = p->channelSlide[channel];
+}
+
+void tMPEPoly_tickBlock(tMPEPoly* const mpe, int numSamples)
+{
+    _tMPEPoly* p = *mpe;
+    
+    if (numSamples <= 0) return;
+    
+    // n samples of the one-pole leave (1-f)^n of the distance, so a block costs one pow
+    if (numSamples != p->lastBlockSize)
+    {
+        p->blockCoef = powf(p->oneMinusFactor, (float)numSamples);
+        p->lastBlockSize = numSamples;
+    }
+    float coef = p->blockCoef;
+    
+    // the six arrays are contiguous, so all three smoothers run as one loop
+    int n = p->numVoices;
+    for (int k = 0; k < 3; k++)
+    {
+        float* curr = p->params + 2 * k * n;
+        float* dest = curr + n;
+        for (int i = 0; i < n; i++)
+            curr[i] = dest[i] + (curr[i] - dest[i]) * coef;
+    }
+}
+
+float tMPEPoly_getPitch(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return (float)p->note[voice] + p->bend[voice];
+}
+
+float tMPEPoly_getPressure(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return p->pressure[voice];
+}
+
+float tMPEPoly_getSlide(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return p->slide[voice];
+}
+
+int tMPEPoly_getKey(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return p->note[voice];
+}
+
+int tMPEPoly_getVelocity(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return p->velocity[voice];
+}
+
+int tMPEPoly_getChannel(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return p->channel[voice];
+}
+
+int tMPEPoly_isOn(tMPEPoly* const mpe, int voice)
+{
+    _tMPEPoly* p = *mpe;
+    return p->isOn[voice];
+}
+
+void tMPEPoly_setSampleRate(tMPEPoly* const mpe, float sr)
+{
+    _tMPEPoly* p = *mpe;
+    p->sampleRate = sr;
+    tMPEPoly_setSmoothTime(mpe, p->smoothTime);
+}
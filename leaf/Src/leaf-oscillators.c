@@ -835,14 +835,15 @@ float tNeuron_tick(tNeuron* const nr)
     
     float output = 0.0f;
     float voltage = n->voltage;
+    LEAFQuality quality = LEAF_QUALITY(n->mempool->leaf);
     
-    n->alpha[0] = (0.01f * (10.0f - voltage)) / (expf((10.0f - voltage)/10.0f) - 1.0f);
-    n->alpha[1] = (0.1f * (25.0f-voltage)) / (expf((25.0f-voltage)/10.0f) - 1.0f);
-    n->alpha[2] = (0.07f * expf((-1.0f * voltage)/20.0f));
+    n->alpha[0] = (0.01f * (10.0f - voltage)) / (LEAF_expQuality((10.0f - voltage)/10.0f, quality) - 1.0f);
+    n->alpha[1] = (0.1f * (25.0f-voltage)) / (LEAF_expQuality((25.0f-voltage)/10.0f, quality) - 1.0f);
+    n->alpha[2] = (0.07f * LEAF_expQuality((-1.0f * voltage)/20.0f, quality));
     
-    n->beta[0] = (0.125f * expf((-1.0f* voltage)/80.0f));
-    n->beta[1] = (4.0f * expf((-1.0f * voltage)/18.0f));
-    n->beta[2] = (1.0f / (expf((30.0f-voltage)/10.0f) + 1.0f));
+    n->beta[0] = (0.125f * LEAF_expQuality((-1.0f* voltage)/80.0f, quality));
+    n->beta[1] = (4.0f * LEAF_expQuality((-1.0f * voltage)/18.0f, quality));
+    n->beta[2] = (1.0f / (LEAF_expQuality((30.0f-voltage)/10.0f, quality) + 1.0f));
     
     for (int i = 0; i < 3; i++)
     {
@@ -862,7 +863,7 @@ float tNeuron_tick(tNeuron* const nr)
     
     if (n->mode == NeuronTanh)
     {
-        n->voltage = 100.0f * tanhf(0.01f * n->voltage);
+        n->voltage = 100.0f * LEAF_tanhQuality(0.01f * n->voltage, quality);
     }
     else if (n->mode == NeuronAaltoShaper)
     {
@@ -2850,6 +2851,10 @@ void    tIntPhasor_initToPool   (tIntPhasor* const cy, tMempool* const mp)
     
     c->phase    =  0;
     c->invSampleRateTimesTwoTo32 = (leaf->invSampleRate * TWO_TO_32);
+    c->controlRate = 0;
+    c->controlCount = 0;
+    c->controlValue = 0.0f;
+    c->controlInc = 0.0f;
 }
 
 void    tIntPhasor_free (tIntPhasor* const cy)
@@ -2869,6 +2874,87 @@ float   tIntPhasor_tick(tIntPhasor* const cy)
     return c->phase * INV_TWO_TO_32; 
 }
 
+// The LFO tickBlocks advance the phase k samples at a time. Phase arithmetic wraps mod
+// 2^32, so this lands exactly where k calls to tick would.
+static float intPhasorAdvance(_tIntPhasor* c, uint32_t k)
+{
+    c->phase = c->phase + c->inc * k;
+    return c->phase * INV_TWO_TO_32;
+}
+
+// The saw and square LFOs are straight lines between phase wraps, so their tickBlocks
+// ramp across a control period and step at the wraps instead of ramping over them.
+// A period is shortened when needed so each phasor wraps at most once in it.
+static uint32_t phasorControlPeriod(_tIntPhasor* c, uint32_t k)
+{
+    if ((uint64_t) c->inc * k < 4294967296ULL) return k;
+    return 0xFFFFFFFFu / c->inc;
+}
+
+// Schedules a step of size for where the phasor wraps in the next n samples, as the
+// control count left when it lands, and returns it so the ramp can aim past it.
+static float phasorControlStep(_tIntPhasor* c, uint32_t n, float size, int* stepAt, float* step)
+{
+    *stepAt = 0;
+    *step = 0.0f;
+    if (c->inc == 0) return 0.0f;
+    
+    uint64_t wrap = (4294967296ULL - c->phase + c->inc - 1) / c->inc;
+    if (wrap > n) return 0.0f;
+    
+    *stepAt = (int) (n - wrap) + 1;
+    *step = size;
+    return size;
+}
+
+// LEAF_controlRamp that adds each pending step to the value just before the sample it lands on
+static int lfoControlRamp(float* output, int numSamples, float* value, float inc, int* count,
+                          int* stepAt, float* step, int numSteps)
+{
+    int done = 0;
+    while (done < numSamples && *count > 0)
+    {
+        int n = numSamples - done;
+        for (int j = 0; j < numSteps; j++)
+        {
+            if (stepAt[j] <= 0 || stepAt[j] > *count) continue;
+            if (stepAt[j] == *count)
+            {
+                *value += step[j];
+                stepAt[j] = 0;
+            }
+            else if (*count - stepAt[j] < n) n = *count - stepAt[j];
+        }
+        done += LEAF_controlRamp(&output[done], n, value, inc, count);
+    }
+    return done;
+}
+
+void    tIntPhasor_tickBlock(tIntPhasor* const cy, float* output, int numSamples)
+{
+    _tIntPhasor* c = *cy;
+    int k = (c->controlRate > 0) ? c->controlRate : c->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (c->controlCount == 0)
+        {
+            uint32_t n = phasorControlPeriod(c, k);
+            float steps = phasorControlStep(c, n, -1.0f, &c->controlStepAt[0], &c->controlStep[0]);
+            c->controlInc = (intPhasorAdvance(c, n) - steps - c->controlValue) / (float) n;
+            c->controlCount = n;
+        }
+        i += lfoControlRamp(&output[i], numSamples - i, &c->controlValue, c->controlInc, &c->controlCount,
+                            c->controlStepAt, c->controlStep, 1);
+    }
+}
+
+void    tIntPhasor_setControlRate(tIntPhasor* const cy, int controlRate)
+{
+    _tIntPhasor* c = *cy;
+    c->controlRate = (controlRate > 0) ? controlRate : 0;
+}
+
 void     tIntPhasor_setFreq(tIntPhasor* const cy, float freq)
 {
     _tIntPhasor* c = *cy;
@@ -2908,6 +2994,10 @@ void    tSquareLFO_initToPool   (tSquareLFO* const cy, tMempool* const mp)
     tIntPhasor_initToPool(&c->phasor,mp);
     tIntPhasor_initToPool(&c->invPhasor,mp); 
     tSquareLFO_setPulseWidth(cy, 0.5f);
+    c->controlRate = 0;
+    c->controlCount = 0;
+    c->controlValue = 0.0f;
+    c->controlInc = 0.0f;
 }
 
 void    tSquareLFO_free (tSquareLFO* const cy)
@@ -2929,6 +3019,47 @@ float   tSquareLFO_tick(tSquareLFO* const cy)
     return 2 * tmp;
 }
 
+static float squareLFOAdvance(_tSquareLFO* c, uint32_t k)
+{
+    float a = intPhasorAdvance(c->phasor, k);
+    float b = intPhasorAdvance(c->invPhasor, k);
+    float tmp = ((a - b)) + c->pulsewidth - 0.5f;
+    return 2 * tmp;
+}
+
+// the edges of the square, falling where the phasor wraps and rising where the inverted one does
+static float squareLFOControlSteps(_tSquareLFO* c, uint32_t n, float scale, int* stepAt, float* step)
+{
+    return phasorControlStep(c->phasor, n, -2.0f * scale, &stepAt[0], &step[0])
+    + phasorControlStep(c->invPhasor, n, 2.0f * scale, &stepAt[1], &step[1]);
+}
+
+void    tSquareLFO_tickBlock(tSquareLFO* const cy, float* output, int numSamples)
+{
+    _tSquareLFO* c = *cy;
+    int k = (c->controlRate > 0) ? c->controlRate : c->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (c->controlCount == 0)
+        {
+            uint32_t n = phasorControlPeriod(c->phasor, k);
+            n = phasorControlPeriod(c->invPhasor, n);
+            float steps = squareLFOControlSteps(c, n, 1.0f, c->controlStepAt, c->controlStep);
+            c->controlInc = (squareLFOAdvance(c, n) - steps - c->controlValue) / (float) n;
+            c->controlCount = n;
+        }
+        i += lfoControlRamp(&output[i], numSamples - i, &c->controlValue, c->controlInc, &c->controlCount,
+                            c->controlStepAt, c->controlStep, 2);
+    }
+}
+
+void    tSquareLFO_setControlRate(tSquareLFO* const cy, int controlRate)
+{
+    _tSquareLFO* c = *cy;
+    c->controlRate = (controlRate > 0) ? controlRate : 0;
+}
+
 void     tSquareLFO_setFreq(tSquareLFO* const cy, float freq)
 {
     _tSquareLFO* c = *cy;
@@ -2973,6 +3104,10 @@ void    tSawSquareLFO_initToPool  (tSawSquareLFO* const cy, tMempool* const mp)
     c->mempool = m;
     tSquareLFO_initToPool(&c->square,mp);
     tIntPhasor_initToPool(&c->saw,mp); 
+    c->controlRate = 0;
+    c->controlCount = 0;
+    c->controlValue = 0.0f;
+    c->controlInc = 0.0f;
 }
 void    tSawSquareLFO_free        (tSawSquareLFO* const cy)
 {
@@ -2989,6 +3124,41 @@ float   tSawSquareLFO_tick        (tSawSquareLFO* const cy)
     float b = tSquareLFO_tick(&c->square);
     return  (1 - c->shape) * a + c->shape * b; 
 }
+
+static float sawSquareLFOAdvance(_tSawSquareLFO* c, uint32_t k)
+{
+    float a = (intPhasorAdvance(c->saw, k) - 0.5f ) * 2.0f;
+    float b = squareLFOAdvance(c->square, k);
+    return  (1 - c->shape) * a + c->shape * b;
+}
+
+void    tSawSquareLFO_tickBlock(tSawSquareLFO* const cy, float* output, int numSamples)
+{
+    _tSawSquareLFO* c = *cy;
+    int k = (c->controlRate > 0) ? c->controlRate : c->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (c->controlCount == 0)
+        {
+            uint32_t n = phasorControlPeriod(c->saw, k);
+            n = phasorControlPeriod(c->square->phasor, n);
+            n = phasorControlPeriod(c->square->invPhasor, n);
+            float steps = phasorControlStep(c->saw, n, -2.0f * (1 - c->shape), &c->controlStepAt[0], &c->controlStep[0])
+            + squareLFOControlSteps(c->square, n, c->shape, &c->controlStepAt[1], &c->controlStep[1]);
+            c->controlInc = (sawSquareLFOAdvance(c, n) - steps - c->controlValue) / (float) n;
+            c->controlCount = n;
+        }
+        i += lfoControlRamp(&output[i], numSamples - i, &c->controlValue, c->controlInc, &c->controlCount,
+                            c->controlStepAt, c->controlStep, 3);
+    }
+}
+
+void    tSawSquareLFO_setControlRate(tSawSquareLFO* const cy, int controlRate)
+{
+    _tSawSquareLFO* c = *cy;
+    c->controlRate = (controlRate > 0) ? controlRate : 0;
+}
 void    tSawSquareLFO_setFreq     (tSawSquareLFO* const cy, float freq)
 {
     _tSawSquareLFO* c = *cy;
@@ -3036,6 +3206,10 @@ void    tTriLFO_initToPool   (tTriLFO* const cy, tMempool* const mp)
     c->invSampleRate = leaf->invSampleRate;
     c->invSampleRateTimesTwoTo32 = (c->invSampleRate * TWO_TO_32);
     tTriLFO_setFreq(cy, 220.0f);
+    c->controlRate = 0;
+    c->controlCount = 0;
+    c->controlValue = 0.0f;
+    c->controlInc = 0.0f;
 }
 
 void    tTriLFO_free (tTriLFO* const cy)
@@ -3045,20 +3219,52 @@ void    tTriLFO_free (tTriLFO* const cy)
     mpool_free((char*)c, c->mempool);
 }
 
+//bitmask fun, in unsigned so the wraps are defined
+static inline float triLFOFold(int32_t phase)
+{
+    uint32_t shiftedPhase = (uint32_t) phase + 1073741824u; // offset by 1/4" wave by adding 2^30 to get things in phase with the other LFO oscillators
+    uint32_t mask = 0u - (shiftedPhase >> 31); //all ones if the sign bit is set
+    shiftedPhase = shiftedPhase + mask; // subtract 1 if negative, zero if positive, to balance
+    shiftedPhase = shiftedPhase ^ mask; //invert the value to get absolute value of integer
+    return (((float)shiftedPhase * INV_TWO_TO_31) - 0.5f) * 2.0f; //scale it to -1.0f to 1.0f float
+}
+
 //need to check bounds and wrap table properly to allow through-zero FM
 float   tTriLFO_tick(tTriLFO* const cy)
 {
     _tTriLFO* c = *cy;
-    c->phase += c->inc;
+    c->phase = (int32_t) ((uint32_t) c->phase + (uint32_t) c->inc);
     
-    //bitmask fun
-    int32_t shiftedPhase = c->phase + 1073741824; // offset by 1/4" wave by adding 2^30 to get things in phase with the other LFO oscillators
-    uint32_t mask = shiftedPhase >> 31; //get the sign bit
-    shiftedPhase = shiftedPhase + mask; // add 1 if negative, zero if positive, to balance
-    shiftedPhase = shiftedPhase ^ mask; //invert the value to get absolute value of integer
-    float output = (((float)shiftedPhase * INV_TWO_TO_31) - 0.5f) * 2.0f; //scale it to -1.0f to 1.0f float
-    return output;
+    return triLFOFold(c->phase);
+}
 
+static float triLFOAdvance(_tTriLFO* c, uint32_t k)
+{
+    c->phase = (int32_t) ((uint32_t) c->phase + (uint32_t) c->inc * k);
+    
+    return triLFOFold(c->phase);
+}
+
+void    tTriLFO_tickBlock(tTriLFO* const cy, float* output, int numSamples)
+{
+    _tTriLFO* c = *cy;
+    int k = (c->controlRate > 0) ? c->controlRate : c->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (c->controlCount == 0)
+        {
+            c->controlInc = (triLFOAdvance(c, k) - c->controlValue) / (float) k;
+            c->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &c->controlValue, c->controlInc, &c->controlCount);
+    }
+}
+
+void    tTriLFO_setControlRate(tTriLFO* const cy, int controlRate)
+{
+    _tTriLFO* c = *cy;
+    c->controlRate = (controlRate > 0) ? controlRate : 0;
 }
 
 void     tTriLFO_setFreq(tTriLFO* const cy, float freq)
@@ -3098,7 +3304,10 @@ void    tSineTriLFO_initToPool  (tSineTriLFO* const cy, tMempool* const mp)
     c->mempool = m;
     tTriLFO_initToPool(&c->tri,mp);
     tCycle_initToPool(&c->sine,mp); 
-   
+    c->controlRate = 0;
+    c->controlCount = 0;
+    c->controlValue = 0.0f;
+    c->controlInc = 0.0f;
 }
 void    tSineTriLFO_free        (tSineTriLFO* const cy)
 {
@@ -3115,6 +3324,40 @@ float   tSineTriLFO_tick        (tSineTriLFO* const cy)
     float b = tTriLFO_tick(&c->tri);
     return  (1.0f - c->shape) * a + c->shape * b;
 }
+
+static float sineTriLFOAdvance(_tSineTriLFO* c, uint32_t k)
+{
+    _tCycle* sine = c->sine;
+    sine->phase += (uint32_t) sine->inc * k;
+    uint32_t idx = sine->phase >> 21;
+    float samp0 = __leaf_table_sinewave[idx];
+    float samp1 = __leaf_table_sinewave[(idx + 1) & sine->mask];
+    float a = samp0 + (samp1 - samp0) * ((float)(sine->phase & 2097151) * 0.000000476837386f);
+    float b = triLFOAdvance(c->tri, k);
+    return  (1.0f - c->shape) * a + c->shape * b;
+}
+
+void    tSineTriLFO_tickBlock(tSineTriLFO* const cy, float* output, int numSamples)
+{
+    _tSineTriLFO* c = *cy;
+    int k = (c->controlRate > 0) ? c->controlRate : c->mempool->leaf->controlRate;
+    
+    for (int i = 0; i < numSamples; )
+    {
+        if (c->controlCount == 0)
+        {
+            c->controlInc = (sineTriLFOAdvance(c, k) - c->controlValue) / (float) k;
+            c->controlCount = k;
+        }
+        i += LEAF_controlRamp(&output[i], numSamples - i, &c->controlValue, c->controlInc, &c->controlCount);
+    }
+}
+
+void    tSineTriLFO_setControlRate(tSineTriLFO* const cy, int controlRate)
+{
+    _tSineTriLFO* c = *cy;
+    c->controlRate = (controlRate > 0) ? controlRate : 0;
+}
 void    tSineTriLFO_setFreq     (tSineTriLFO* const cy, float freq)
 {
     _tSineTriLFO* c = *cy;
@@ -43,6 +43,7 @@ void    tPluck_initToPool    (tPluck* const pl, float lowestFrequency, tMempool*
     tAllpassDelay_clear(&p->delayLine);
     
     tPluck_setFrequency(pl, 220.0f);
+    tPluck_updateDelays(pl);
 }
 
 void    tPluck_free (tPluck* const pl)
@@ -64,6 +65,13 @@ float   tPluck_getLastOut    (tPluck* const pl)
 }
 
 float   tPluck_tick          (tPluck* const pl)
+{
+    _tPluck* p = *pl;
+    if (p->paramsChanged) tPluck_updateDelays(pl);
+    return tPluck_tickEfficient(pl);
+}
+
+float   tPluck_tickEfficient (tPluck* const pl)
 {
     _tPluck* p = *pl;
     return (p->lastOut = 3.0f * tAllpassDelay_tick(&p->delayLine, tOneZero_tick(&p->loopFilter, tAllpassDelay_getLastOut(&p->delayLine) * p->loopGain ) ));
@@ -79,6 +87,8 @@ void    tPluck_pluck         (tPluck* const pl, float amplitude)
     tOnePole_setPole(&p->pickFilter, 0.999f - (amplitude * 0.15f));
     tOnePole_setGain(&p->pickFilter, amplitude * 0.5f );
     
+    if (p->paramsChanged) tPluck_updateDelays(pl);
+    
     // Fill delay with noise additively with current contents.
     for ( uint32_t i = 0; i < (uint32_t)tAllpassDelay_getDelay(&p->delayLine); i++ )
         tAllpassDelay_tick(&p->delayLine, 0.6f * tAllpassDelay_getLastOut(&p->delayLine) + tOnePole_tick(&p->pickFilter, tNoise_tick(&p->noise) ) );
@@ -111,16 +121,27 @@ void    tPluck_setFrequency  (tPluck* const pl, float frequency )
     
     if ( frequency <= 0.0f )   frequency = 0.001f;
     
-    // Delay = length - filter delay.
-    float delay = ( p->sampleRate / frequency ) - tOneZero_getPhaseDelay(&p->loopFilter, frequency );
-    
-    tAllpassDelay_setDelay(&p->delayLine, delay );
+    p->lastFreq = frequency;
+    p->paramsChanged = 1;
     
     p->loopGain = 0.99f + (frequency * 0.000005f);
     
     if ( p->loopGain >= 0.999f ) p->loopGain = 0.999f;
 }
 
+// Apply a pending frequency change to the delay line.
+void    tPluck_updateDelays  (tPluck* const pl)
+{
+    _tPluck* p = *pl;
+    
+    // Delay = length - filter delay.
+    float delay = ( p->sampleRate / p->lastFreq ) - tOneZero_getPhaseDelay(&p->loopFilter, p->lastFreq );
+    
+    tAllpassDelay_setDelay(&p->delayLine, delay );
+    
+    p->paramsChanged = 0;
+}
+
 // Perform the control change specified by \e number and \e value (0.0 - 128.0).
 void    tPluck_controlChange (tPluck* const pl, int number, float value)
 {
@@ -136,9 +157,9 @@ void tPluck_setSampleRate(tPluck* const pl, float sr)
     tAllpassDelay_initToPool(&p->delayLine, 0.0f, p->sampleRate * 2, &p->mempool);
     tAllpassDelay_clear(&p->delayLine);
     
-    tPluck_setFrequency(pl, p->lastFreq);
     tOnePole_setSampleRate(&p->pickFilter, p->sampleRate);
     tOneZero_setSampleRate(&p->loopFilter, p->sampleRate);
+    tPluck_setFrequency(pl, p->lastFreq);
 }
 
 /* ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ tKarplusStrong ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ ~ */
@@ -181,6 +202,7 @@ void    tKarplusStrong_initToPool   (tKarplusStrong* const pl, float lowestFrequ
     p->loopGain = 0.999f;
     
     tKarplusStrong_setFrequency( pl, 220.0f );
+    tKarplusStrong_updateDelays( pl );
 }
 
 void    tKarplusStrong_free (tKarplusStrong* const pl)
@@ -207,6 +229,13 @@ float   tKarplusStrong_getLastOut    (tKarplusStrong* const pl)
 }
 
 float   tKarplusStrong_tick          (tKarplusStrong* const pl)
+{
+    _tKarplusStrong* p = *pl;
+    if (p->paramsChanged) tKarplusStrong_updateDelays(pl);
+    return tKarplusStrong_tickEfficient(pl);
+}
+
+float   tKarplusStrong_tickEfficient (tKarplusStrong* const pl)
 {
     _tKarplusStrong* p = *pl;
     
@@ -234,6 +263,8 @@ void    tKarplusStrong_pluck         (tKarplusStrong* const pl, float amplitude)
     
     p->pluckAmplitude = amplitude;
     
+    if (p->paramsChanged) tKarplusStrong_updateDelays(pl);
+    
     for ( uint32_t i=0; i < (uint32_t)tAllpassDelay_getDelay(&p->delayLine); i++ )
     {
         // Fill delay with noise additively with current contents.
@@ -269,16 +300,11 @@ void    tKarplusStrong_setFrequency  (tKarplusStrong* const pl, float frequency
     
     p->lastFrequency = frequency;
     p->lastLength = p->sampleRate / p->lastFrequency;
-    float delay = p->lastLength - 0.5f;
-    tAllpassDelay_setDelay(&p->delayLine, delay);
+    p->paramsChanged = 1;
     
     // MAYBE MODIFY LOOP GAINS
     p->loopGain = p->baseLoopGain + (frequency * 0.000005f);
     if (p->loopGain >= 1.0f) p->loopGain = 0.99999f;
-    
-    tKarplusStrong_setStretch(pl, p->stretching);
-    
-    tLinearDelay_setDelay(&p->combDelay, 0.5f * p->pickupPosition * p->lastLength );
 }
 
 // Set the stretch "factor" of the string (0.0 - 1.0).
@@ -287,10 +313,23 @@ void    tKarplusStrong_setStretch         (tKarplusStrong* const pl, float stret
     _tKarplusStrong* p = *pl;
     
     p->stretching = stretch;
+    p->paramsChanged = 1;
+}
+
+// Apply pending frequency, stretch and pickup position changes.
+void    tKarplusStrong_updateDelays       (tKarplusStrong* const pl)
+{
+    _tKarplusStrong* p = *pl;
+    
+    float delay = p->lastLength - 0.5f;
+    tAllpassDelay_setDelay(&p->delayLine, delay);
+    
+    tLinearDelay_setDelay(&p->combDelay, 0.5f * p->pickupPosition * p->lastLength );
+    
     float coefficient;
     float freq = p->lastFrequency * 2.0f;
     float dFreq = ( (0.5f * p->sampleRate) - freq ) * 0.25f;
-    float temp = 0.5f + (stretch * 0.5f);
+    float temp = 0.5f + (p->stretching * 0.5f);
     if ( temp > 0.9999f ) temp = 0.9999f;
     
     for ( int i=0; i<4; i++ )
@@ -306,6 +345,8 @@ void    tKarplusStrong_setStretch         (tKarplusStrong* const pl, float stret
         
         freq += dFreq;
     }
+    
+    p->paramsChanged = 0;
 }
 
 // Set the pluck or "excitation" position along the string (0.0 - 1.0).
@@ -317,7 +358,7 @@ void    tKarplusStrong_setPickupPosition  (tKarplusStrong* const pl, float posit
     else if (position <= 1.0f)  p->pickupPosition = position;
     else                        p->pickupPosition = 1.0f;
     
-    tLinearDelay_setDelay(&p->combDelay, 0.5f * p->pickupPosition * p->lastLength);
+    p->paramsChanged = 1;
 }
 
 // Set the base loop gain.
@@ -473,14 +514,28 @@ float   tSimpleLivingString_tick(tSimpleLivingString* const pl, float input)
 {
     _tSimpleLivingString* p = *pl;
     
+    tSimpleLivingString_tickEfficient(pl, input);
+    tLinearDelay_setDelay(&p->delayLine, tExpSmooth_tick(&p->wlSmooth));
+    return p->curr;
+}
+
+float   tSimpleLivingString_tickEfficient(tSimpleLivingString* const pl, float input)
+{
+    _tSimpleLivingString* p = *pl;
+    
     float stringOut=tOnePole_tick(&p->bridgeFilter,tLinearDelay_tickOut(&p->delayLine));
     float stringInput=tHighpass_tick(&p->DCblocker, tFeedbackLeveler_tick(&p->fbLev, (p->levMode==0?p->decay*stringOut:stringOut)+input));
     tLinearDelay_tickIn(&p->delayLine, stringInput);
-    tLinearDelay_setDelay(&p->delayLine, tExpSmooth_tick(&p->wlSmooth));
     p->curr = stringOut;
     return p->curr;
 }
 
+void    tSimpleLivingString_updateDelays(tSimpleLivingString* const pl)
+{
+    _tSimpleLivingString* p = *pl;
+    tLinearDelay_setDelay(&p->delayLine, p->wlSmooth->dest);
+}
+
 float   tSimpleLivingString_sample(tSimpleLivingString* const pl)
 {
     _tSimpleLivingString* p = *pl;
@@ -608,14 +663,28 @@ float   tSimpleLivingString2_tick(tSimpleLivingString2* const pl, float input)
 {
     _tSimpleLivingString2* p = *pl;
 
+    tSimpleLivingString2_tickEfficient(pl, input);
+    tHermiteDelay_setDelay(&p->delayLine, tExpSmooth_tick(&p->wlSmooth));
+    return p->curr;
+}
+
+float   tSimpleLivingString2_tickEfficient(tSimpleLivingString2* const pl, float input)
+{
+    _tSimpleLivingString2* p = *pl;
+
     float stringOut=tTwoZero_tick(&p->bridgeFilter,tHermiteDelay_tickOut(&p->delayLine));
     float stringInput=tHighpass_tick(&p->DCblocker,(tFeedbackLeveler_tick(&p->fbLev, (p->levMode==0?p->decay*stringOut:stringOut)+input)));
     tHermiteDelay_tickIn(&p->delayLine, stringInput);
-    tHermiteDelay_setDelay(&p->delayLine, tExpSmooth_tick(&p->wlSmooth));
     p->curr = stringOut;
     return p->curr;
 }
 
+void    tSimpleLivingString2_updateDelays(tSimpleLivingString2* const pl)
+{
+    _tSimpleLivingString2* p = *pl;
+    tHermiteDelay_setDelay(&p->delayLine, p->wlSmooth->dest);
+}
+
 
 float   tSimpleLivingString2_sample(tSimpleLivingString2* const pl)
 {
@@ -783,10 +852,32 @@ void     tLivingString_setLevMode(tLivingString* const pl, int levMode)
     p->levMode=levMode;
 }
 
+static void livingStringSetDelays(_tLivingString* p, float pickP, float wLen)
+{
+    float lowLen=pickP*wLen;
+    float upLen=(1.0f-pickP)*wLen;
+    tLinearDelay_setDelay(&p->delLF, lowLen);
+    tLinearDelay_setDelay(&p->delLB, lowLen);
+    tLinearDelay_setDelay(&p->delUF, upLen);
+    tLinearDelay_setDelay(&p->delUB, upLen);
+}
+
 float   tLivingString_tick(tLivingString* const pl, float input)
 {
     _tLivingString* p = *pl;
     
+    tLivingString_tickEfficient(pl, input);
+    // update all delay lengths
+    float pickP=tExpSmooth_tick(&p->ppSmooth);
+    float wLen=tExpSmooth_tick(&p->wlSmooth);
+    livingStringSetDelays(p, pickP, wLen);
+    return p->curr;
+}
+
+float   tLivingString_tickEfficient(tLivingString* const pl, float input)
+{
+    _tLivingString* p = *pl;
+    
     // from pickPos upwards=forwards
     float fromLF=tLinearDelay_tickOut(&p->delLF);
     float fromUF=tLinearDelay_tickOut(&p->delUF);
@@ -806,19 +897,16 @@ float   tLivingString_tick(tLivingString* const pl, float input)
     float fromUpperPrep=-tOnePole_tick(&p->prepFilterU, fromUB);
     float intoUpper=p->prepIndex*fromUpperPrep+(1.0f - p->prepIndex)*fromLF+input;
     tLinearDelay_tickIn(&p->delUF, intoUpper);
-    // update all delay lengths
-    float pickP=tExpSmooth_tick(&p->ppSmooth);
-    float wLen=tExpSmooth_tick(&p->wlSmooth);
-    float lowLen=pickP*wLen;
-    float upLen=(1.0f-pickP)*wLen;
-    tLinearDelay_setDelay(&p->delLF, lowLen);
-    tLinearDelay_setDelay(&p->delLB, lowLen);
-    tLinearDelay_setDelay(&p->delUF, upLen);
-    tLinearDelay_setDelay(&p->delUB, upLen);
     p->curr = fromBridge;
     return p->curr;
 }
 
+void    tLivingString_updateDelays(tLivingString* const pl)
+{
+    _tLivingString* p = *pl;
+    livingStringSetDelays(p, p->ppSmooth->dest, p->wlSmooth->dest);
+}
+
 float   tLivingString_sample(tLivingString* const pl)
 {
     _tLivingString* p = *pl;
@@ -1442,10 +1530,41 @@ void     tComplexLivingString_setLevMode(tComplexLivingString* const pl, int lev
     p->levMode=levMode;
 }
 
+static void complexLivingStringSetDelays(_tComplexLivingString* p, float pickP, float prepP, float wLen)
+{
+    float midLen = (pickP-prepP) * wLen; // the length between the pick and the prep;
+    float lowLen = prepP*wLen; // the length from prep to nut
+    float upLen = (1.0f-pickP)*wLen; // the length from pick to bridge
+
+    tLinearDelay_setDelay(&p->delLF, lowLen);
+    tLinearDelay_setDelay(&p->delLB, lowLen);
+
+    tLinearDelay_setDelay(&p->delMF, midLen);
+    tLinearDelay_setDelay(&p->delMB, midLen);
+
+    tLinearDelay_setDelay(&p->delUF, upLen);
+    tLinearDelay_setDelay(&p->delUB, upLen);
+}
+
 float   tComplexLivingString_tick(tComplexLivingString* const pl, float input)
 {
     _tComplexLivingString* p = *pl;
 
+    tComplexLivingString_tickEfficient(pl, input);
+
+    // update all delay lengths
+    float pickP=tExpSmooth_tick(&p->pickPosSmooth);
+    float prepP=tExpSmooth_tick(&p->prepPosSmooth);
+    float wLen=tExpSmooth_tick(&p->wlSmooth);
+    complexLivingStringSetDelays(p, pickP, prepP, wLen);
+
+    return p->curr;
+}
+
+float   tComplexLivingString_tickEfficient(tComplexLivingString* const pl, float input)
+{
+    _tComplexLivingString* p = *pl;
+
     // from pickPos upwards=forwards
     float fromLF=tLinearDelay_tickOut(&p->delLF);
     float fromMF=tLinearDelay_tickOut(&p->delMF);
@@ -1480,30 +1599,17 @@ float   tComplexLivingString_tick(tComplexLivingString* const pl, float input)
     //take output of middle segment and put it into upper segment connecting to the bridge
     tLinearDelay_tickIn(&p->delUF, fromMF);
 
-    // update all delay lengths
-    float pickP=tExpSmooth_tick(&p->pickPosSmooth);
-    float prepP=tExpSmooth_tick(&p->prepPosSmooth);
-    float wLen=tExpSmooth_tick(&p->wlSmooth);
-
-    float midLen = (pickP-prepP) * wLen; // the length between the pick and the prep;
-    float lowLen = prepP*wLen; // the length from prep to nut
-    float upLen = (1.0f-pickP)*wLen; // the length from pick to bridge
-
-
-    tLinearDelay_setDelay(&p->delLF, lowLen);
-    tLinearDelay_setDelay(&p->delLB, lowLen);
-
-    tLinearDelay_setDelay(&p->delMF, midLen);
-    tLinearDelay_setDelay(&p->delMB, midLen);
-
-    tLinearDelay_setDelay(&p->delUF, upLen);
-    tLinearDelay_setDelay(&p->delUB, upLen);
-
     //update this to allow pickup position variation
     p->curr = fromBridge;
     return p->curr;
 }
 
+void    tComplexLivingString_updateDelays(tComplexLivingString* const pl)
+{
+    _tComplexLivingString* p = *pl;
+    complexLivingStringSetDelays(p, p->pickPosSmooth->dest, p->prepPosSmooth->dest, p->wlSmooth->dest);
+}
+
 float   tComplexLivingString_sample(tComplexLivingString* const pl)
 {
     _tComplexLivingString* p = *pl;
@@ -1525,6 +1631,681 @@ void    tComplexLivingString_setSampleRate(tComplexLivingString* const pl, float
     tHighpass_setSampleRate(&p->DCblockerL, p->sampleRate);
 }
 
+//////////---------------------------
+
+/* Living String Bank (tLivingString2 strings ticked together) */
+
+#define LIVINGSTRINGBANK_NUM_PARAMS 34
+
+void    tLivingStringBank_init(tLivingStringBank* const bank, int numStrings, float freq, float pickPos, float prepPos,
+                               float pickupPos, float prepIndex, float brightness, float decay, float targetLev,
+                               float levSmoothFactor, float levStrength, int levMode, LEAF* const leaf)
+{
+    tLivingStringBank_initToPool(bank, numStrings, freq, pickPos, prepPos, pickupPos, prepIndex, brightness, decay, targetLev,
+                                 levSmoothFactor, levStrength, levMode, &leaf->mempool);
+}
+
+void    tLivingStringBank_initToPool(tLivingStringBank* const bank, int numStrings, float freq, float pickPos, float prepPos,
+                                     float pickupPos, float prepIndex, float brightness, float decay, float targetLev,
+                                     float levSmoothFactor, float levStrength, int levMode, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tLivingStringBank* b = *bank = (_tLivingStringBank*) mpool_alloc(sizeof(_tLivingStringBank), m);
+    b->mempool = m;
+    LEAF* leaf = b->mempool->leaf;
+    
+    if (numStrings < 1) numStrings = 1;
+    b->numStrings = numStrings;
+    b->sampleRate = leaf->sampleRate;
+    b->twoPiTimesInvSampleRate = leaf->twoPiTimesInvSampleRate;
+    
+    b->bufferMask = LIVINGSTRINGBANK_LINE_SIZE - 1;
+    b->buff = (float*) mpool_calloc(sizeof(float) * LIVINGSTRINGBANK_LINE_SIZE * 4 * numStrings, m);
+    
+    b->points = (uint32_t*) mpool_calloc(sizeof(uint32_t) * numStrings * 3, m);
+    b->inPoint   = b->points;
+    b->outPointL = b->points + numStrings;
+    b->outPointU = b->points + numStrings * 2;
+    
+    b->state = (float*) mpool_calloc(sizeof(float) * numStrings * LIVINGSTRINGBANK_NUM_PARAMS, m);
+    float** params[LIVINGSTRINGBANK_NUM_PARAMS] =
+    {
+        &b->wlCurr, &b->wlDest, &b->ppCurr, &b->ppDest, &b->prpCurr, &b->prpDest, &b->puCurr, &b->puDest,
+        &b->alphaL, &b->alphaU, &b->freq, &b->waveLength, &b->prepIndex, &b->decay, &b->curr,
+        &b->bridgeLast, &b->bridgeLast2, &b->nutLast, &b->nutLast2,
+        &b->prepULast, &b->prepULast2, &b->prepLLast, &b->prepLLast2,
+        &b->dcUIn, &b->dcUOut, &b->dcLIn, &b->dcLOut, &b->levUPower, &b->levLPower,
+        &b->waveLF, &b->waveUF, &b->waveUB, &b->waveLB, &b->in
+    };
+    for (int i = 0; i < LIVINGSTRINGBANK_NUM_PARAMS; i++) *params[i] = b->state + numStrings * i;
+    
+    // smoothing factors and DC blocker as set up by tLivingString2
+    b->wlFactor = 0.1f;
+    b->wlOneMinusFactor = 1.0f - 0.1f;
+    b->posFactor = 0.01f;
+    b->posOneMinusFactor = 1.0f - 0.01f;
+    b->dcR = (1.0f - (8.0f * b->twoPiTimesInvSampleRate));
+    
+    b->levTarget = targetLev;
+    b->levStrength = levStrength;
+    b->levFactor = levSmoothFactor;
+    b->levOneMinusFactor = 1.0f - levSmoothFactor;
+    b->levMode = levMode;
+    tLivingStringBank_setBrightness(bank, brightness);
+    
+    for (int s = 0; s < numStrings; s++)
+    {
+        b->wlCurr[s] = b->sampleRate / freq;
+        tLivingStringBank_setFreq(bank, s, freq);
+        b->freq[s] = freq;
+        b->ppCurr[s] = pickPos;
+        b->prpCurr[s] = prepPos;
+        tLivingStringBank_setPickPos(bank, s, pickPos);
+        tLivingStringBank_setPrepPos(bank, s, prepPos);
+        b->puCurr[s] = b->puDest[s] = pickupPos;
+        b->prepIndex[s] = prepIndex;
+        b->decay[s] = decay;
+        
+        // every line starts at the full wavelength, as in tLivingString2
+        float outPointer = 0.0f - b->waveLength[s];
+        while (outPointer < 0) outPointer += LIVINGSTRINGBANK_LINE_SIZE;
+        uint32_t outPoint = (uint32_t) outPointer;
+        b->alphaL[s] = b->alphaU[s] = outPointer - outPoint;
+        b->outPointL[s] = b->outPointU[s] = outPoint & b->bufferMask;
+    }
+}
+
+void    tLivingStringBank_free(tLivingStringBank* const bank)
+{
+    _tLivingStringBank* b = *bank;
+    
+    mpool_free((char*)b->state, b->mempool);
+    mpool_free((char*)b->points, b->mempool);
+    mpool_free((char*)b->buff, b->mempool);
+    mpool_free((char*)b, b->mempool);
+}
+
+static inline float livingStringBankLevel(_tLivingStringBank* b, float* power, float input)
+{
+    *power = b->levFactor * input * input + b->levOneMinusFactor * *power;
+    float levdiff = *power - b->levTarget;
+    if (b->levMode == 0 && levdiff < 0.0f) levdiff = 0.0f;
+    return input * (1.0f - b->levStrength * levdiff);
+}
+
+static inline float livingStringBankTap(float* line, uint32_t inPoint, uint32_t tapDelay, uint32_t mask)
+{
+    return line[(inPoint - tapDelay - 1) & mask];
+}
+
+// One sample of every string, taking input from b->in and leaving the outputs in b->curr.
+// The waveguide gathers are done string by string; the filters and levelers run as
+// straight loops over the per-string arrays so the compiler can vectorize them.
+static void livingStringBankProcess(_tLivingStringBank* b)
+{
+    int n = b->numStrings;
+    uint32_t mask = b->bufferMask;
+    uint32_t size = mask + 1;
+    
+    for (int s = 0; s < n; s++)
+    {
+        b->wlCurr[s] = b->wlFactor * b->wlDest[s] + b->wlOneMinusFactor * b->wlCurr[s];
+        b->ppCurr[s] = b->posFactor * b->ppDest[s] + b->posOneMinusFactor * b->ppCurr[s];
+        b->prpCurr[s] = b->posFactor * b->prpDest[s] + b->posOneMinusFactor * b->prpCurr[s];
+        b->puCurr[s] = b->posFactor * b->puDest[s] + b->posOneMinusFactor * b->puCurr[s];
+    }
+    
+    for (int s = 0; s < n; s++)
+    {
+        float* delLF = b->buff + (uint32_t) s * size * 4;
+        float* delUF = delLF + size;
+        float* delUB = delUF + size;
+        float* delLB = delUB + size;
+        uint32_t inPoint = b->inPoint[s];
+        
+        // add the input at the pick point, half into each direction
+        float input = b->in[s] * 0.5f;
+        if (input != 0.0f)
+        {
+            float wLen = b->wlCurr[s];
+            float pickP = b->ppCurr[s];
+            float prepP = b->prpCurr[s];
+            float lowLen = prepP * wLen;
+            float upLen = (1.0f - prepP) * wLen;
+            
+            float* fw = delLF;
+            float* bw = delLB;
+            float len = lowLen;
+            float fullPickPoint = pickP * wLen;
+            if (pickP > prepP)
+            {
+                fw = delUF;
+                bw = delUB;
+                len = upLen;
+                fullPickPoint = ((pickP * wLen) - lowLen);
+            }
+            uint32_t pickPInt = (uint32_t) fullPickPoint;
+            float pickPFloat = fullPickPoint - pickPInt;
+            
+            fw[(inPoint - pickPInt - 1) & mask] += input * (1.0f - pickPFloat);
+            fw[(inPoint - (pickPInt + 1) - 1) & mask] += input * pickPFloat;
+            bw[(inPoint - (uint32_t) (len - pickPInt) - 1) & mask] += input * (1.0f - pickPFloat);
+            bw[(inPoint - (uint32_t) (len - pickPInt - 1) - 1) & mask] += input * pickPFloat;
+        }
+        
+        uint32_t idx = b->outPointL[s];
+        float alpha = b->alphaL[s];
+        b->waveLF[s] = LEAF_interpolate_hermite_x(delLF[((idx - 1) + size) & mask], delLF[idx],
+                                                  delLF[(idx + 1) & mask], delLF[(idx + 2) & mask], alpha);
+        b->waveLB[s] = LEAF_interpolate_hermite_x(delLB[((idx - 1) + size) & mask], delLB[idx],
+                                                  delLB[(idx + 1) & mask], delLB[(idx + 2) & mask], alpha);
+        idx = b->outPointU[s];
+        alpha = b->alphaU[s];
+        b->waveUF[s] = LEAF_interpolate_hermite_x(delUF[((idx - 1) + size) & mask], delUF[idx],
+                                                  delUF[(idx + 1) & mask], delUF[(idx + 2) & mask], alpha);
+        b->waveUB[s] = LEAF_interpolate_hermite_x(delUB[((idx - 1) + size) & mask], delUB[idx],
+                                                  delUB[(idx + 1) & mask], delUB[(idx + 2) & mask], alpha);
+    }
+    
+    // bridge, nut and preparation point, with the coefficients shared by every string
+    float h0 = b->h0;
+    float h1 = b->h1;
+    float R = b->dcR;
+    for (int s = 0; s < n; s++)
+    {
+        float fromLF = b->waveLF[s];
+        float fromUF = b->waveUF[s];
+        float fromUB = b->waveUB[s];
+        float fromLB = b->waveLB[s];
+        float gain = (b->levMode == 0) ? b->decay[s] : 1.0f;
+        
+        float x = h1 * b->bridgeLast2[s] + h0 * b->bridgeLast[s] + h1 * fromUF;
+        b->bridgeLast2[s] = b->bridgeLast[s];
+        b->bridgeLast[s] = fromUF;
+        b->dcUOut[s] = x - b->dcUIn[s] + R * b->dcUOut[s];
+        b->dcUIn[s] = x;
+        float fromBridge = -livingStringBankLevel(b, &b->levUPower[s], gain * b->dcUOut[s]);
+        
+        x = h1 * b->prepLLast2[s] + h0 * b->prepLLast[s] + h1 * fromLF;
+        b->prepLLast2[s] = b->prepLLast[s];
+        b->prepLLast[s] = fromLF;
+        float intoLower = b->prepIndex[s] * -x + (1.0f - b->prepIndex[s]) * fromUB;
+        
+        x = h1 * b->nutLast2[s] + h0 * b->nutLast[s] + h1 * fromLB;
+        b->nutLast2[s] = b->nutLast[s];
+        b->nutLast[s] = fromLB;
+        b->dcLOut[s] = x - b->dcLIn[s] + R * b->dcLOut[s];
+        b->dcLIn[s] = x;
+        float fromNut = -livingStringBankLevel(b, &b->levLPower[s], gain * b->dcLOut[s]);
+        
+        x = h1 * b->prepULast2[s] + h0 * b->prepULast[s] + h1 * fromUB;
+        b->prepULast2[s] = b->prepULast[s];
+        b->prepULast[s] = fromUB;
+        float intoUpper = b->prepIndex[s] * -x + (1.0f - b->prepIndex[s]) * fromLF;
+        
+        b->waveLF[s] = fromNut;
+        b->waveUF[s] = intoUpper;
+        b->waveUB[s] = fromBridge;
+        b->waveLB[s] = intoLower;
+    }
+    
+    for (int s = 0; s < n; s++)
+    {
+        float* delLF = b->buff + (uint32_t) s * size * 4;
+        float* delUF = delLF + size;
+        float* delUB = delUF + size;
+        float* delLB = delUB + size;
+        uint32_t inPoint = b->inPoint[s];
+        
+        delLF[inPoint] = b->waveLF[s];
+        delUF[inPoint] = b->waveUF[s];
+        delUB[inPoint] = b->waveUB[s];
+        delLB[inPoint] = b->waveLB[s];
+        inPoint = (inPoint + 1) & mask;
+        b->inPoint[s] = inPoint;
+        
+        // update the delay lengths
+        float wLen = b->wlCurr[s];
+        float prepP = b->prpCurr[s];
+        float lowLen = prepP * wLen;
+        float upLen = (1.0f - prepP) * wLen;
+        
+        float outPointer = inPoint - lowLen;
+        while (outPointer < 0) outPointer += size;
+        uint32_t outPoint = (uint32_t) outPointer;
+        b->alphaL[s] = outPointer - outPoint;
+        b->outPointL[s] = outPoint & mask;
+        
+        outPointer = inPoint - upLen;
+        while (outPointer < 0) outPointer += size;
+        outPoint = (uint32_t) outPointer;
+        b->alphaU[s] = outPointer - outPoint;
+        b->outPointU[s] = outPoint & mask;
+        
+        float pupos = b->puCurr[s];
+        if (pupos < 0.9999f)
+        {
+            float* fw = delLF;
+            float* bw = delLB;
+            float len = lowLen;
+            float fullPUPoint = pupos * wLen;
+            if (pupos > prepP)
+            {
+                fw = delUF;
+                bw = delUB;
+                len = upLen;
+                fullPUPoint = ((pupos * wLen) - lowLen);
+            }
+            uint32_t PUPInt = (uint32_t) fullPUPoint;
+            float PUPFloat = fullPUPoint - PUPInt;
+            
+            float pickupOut = livingStringBankTap(fw, inPoint, PUPInt, mask) * (1.0f - PUPFloat);
+            pickupOut += livingStringBankTap(fw, inPoint, PUPInt + 1, mask) * PUPFloat;
+            pickupOut += livingStringBankTap(bw, inPoint, (uint32_t) (len - PUPInt), mask) * (1.0f - PUPFloat);
+            pickupOut += livingStringBankTap(bw, inPoint, (uint32_t) (len - PUPInt - 1), mask) * PUPFloat;
+            b->curr[s] = pickupOut;
+        }
+        else b->curr[s] = b->waveUB[s];
+    }
+}
+
+void    tLivingStringBank_tick(tLivingStringBank* const bank, float* input, float* output)
+{
+    _tLivingStringBank* b = *bank;
+    
+    for (int s = 0; s < b->numStrings; s++) b->in[s] = input[s];
+    livingStringBankProcess(b);
+    for (int s = 0; s < b->numStrings; s++) output[s] = b->curr[s];
+}
+
+float   tLivingStringBank_tickMix(tLivingStringBank* const bank, float* input)
+{
+    _tLivingStringBank* b = *bank;
+    
+    for (int s = 0; s < b->numStrings; s++) b->in[s] = input[s];
+    livingStringBankProcess(b);
+    
+    float mix = 0.0f;
+    for (int s = 0; s < b->numStrings; s++) mix += b->curr[s];
+    return mix;
+}
+
+void    tLivingStringBank_tickBlock(tLivingStringBank* const bank, float** input, float** output, int numSamples)
+{
+    _tLivingStringBank* b = *bank;
+    
+    for (int i = 0; i < numSamples; i++)
+    {
+        for (int s = 0; s < b->numStrings; s++) b->in[s] = (input[s] != NULL) ? input[s][i] : 0.0f;
+        livingStringBankProcess(b);
+        for (int s = 0; s < b->numStrings; s++) if (output[s] != NULL) output[s][i] = b->curr[s];
+    }
+}
+
+float   tLivingStringBank_sample(tLivingStringBank* const bank, int string)
+{
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return 0.0f;
+    return b->curr[string];
+}
+
+void    tLivingStringBank_setFreq(tLivingStringBank* const bank, int string, float freq)
+{    // NOTE: It is faster to set wavelength in samples directly
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    
+    if (freq<20.f) freq=20.f;
+    else if (freq>10000.f) freq=10000.f;
+    freq = freq*2;
+    b->freq[string] = freq;
+    b->waveLength[string] = (b->sampleRate/freq) - 1;
+    b->wlDest[string] = b->waveLength[string];
+}
+
+void    tLivingStringBank_setWaveLength(tLivingStringBank* const bank, int string, float waveLength)
+{
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    
+    waveLength = waveLength * 0.5f;
+    if (waveLength<4.8f) waveLength=4.8f;
+    else if (waveLength>2400.f) waveLength=2400.f;
+    b->waveLength[string] = waveLength - 1;
+    b->freq[string] = b->sampleRate / waveLength;
+    b->wlDest[string] = b->waveLength[string];
+}
+
+void    tLivingStringBank_setPickPos(tLivingStringBank* const bank, int string, float pickPos)
+{    // between 0 and 1
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    if (pickPos<0.f) pickPos=0.f;
+    else if (pickPos>1.f) pickPos=1.f;
+    b->ppDest[string] = pickPos;
+}
+
+void    tLivingStringBank_setPrepPos(tLivingStringBank* const bank, int string, float prepPos)
+{    // between 0 and 1
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    if (prepPos<0.f) prepPos=0.f;
+    else if (prepPos>1.f) prepPos=1.f;
+    b->prpDest[string] = prepPos;
+}
+
+void    tLivingStringBank_setPickupPos(tLivingStringBank* const bank, int string, float pickupPos)
+{    // between 0 and 1
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    if (pickupPos<0.f) pickupPos=0.f;
+    else if (pickupPos>1.f) pickupPos=1.f;
+    b->puDest[string] = pickupPos;
+}
+
+void    tLivingStringBank_setPrepIndex(tLivingStringBank* const bank, int string, float prepIndex)
+{    // between 0 and 1
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    if (prepIndex<0.f) prepIndex=0.f;
+    else if (prepIndex>1.f) prepIndex=1.f;
+    b->prepIndex[string] = prepIndex;
+}
+
+void    tLivingStringBank_setDecay(tLivingStringBank* const bank, int string, float decay)
+{
+    _tLivingStringBank* b = *bank;
+    if (string < 0 || string >= b->numStrings) return;
+    b->decay[string] = powf(0.001f,1.0f/(b->freq[string]*decay));
+}
+
+void    tLivingStringBank_setBrightness(tLivingStringBank* const bank, float brightness)
+{
+    _tLivingStringBank* b = *bank;
+    b->h0 = (1.0 + brightness) * 0.5f;
+    b->h1 = (1.0 - brightness) * 0.25f;
+}
+
+void    tLivingStringBank_setTargetLev(tLivingStringBank* const bank, float targetLev)
+{
+    _tLivingStringBank* b = *bank;
+    b->levTarget = targetLev;
+}
+
+void    tLivingStringBank_setLevSmoothFactor(tLivingStringBank* const bank, float levSmoothFactor)
+{
+    _tLivingStringBank* b = *bank;
+    if (levSmoothFactor<0) levSmoothFactor=0;
+    if (levSmoothFactor>1) levSmoothFactor=1;
+    b->levFactor = levSmoothFactor;
+    b->levOneMinusFactor = 1.0f - levSmoothFactor;
+}
+
+void    tLivingStringBank_setLevStrength(tLivingStringBank* const bank, float levStrength)
+{
+    _tLivingStringBank* b = *bank;
+    b->levStrength = levStrength;
+}
+
+void    tLivingStringBank_setLevMode(tLivingStringBank* const bank, int levMode)
+{
+    _tLivingStringBank* b = *bank;
+    b->levMode = levMode;
+}
+
+void    tLivingStringBank_setSampleRate(tLivingStringBank* const bank, float sr)
+{
+    _tLivingStringBank* b = *bank;
+    b->sampleRate = sr;
+    b->twoPiTimesInvSampleRate = TWO_PI * (1.0f/sr);
+    b->dcR = (1.0f - (8.0f * b->twoPiTimesInvSampleRate));
+    for (int s = 0; s < b->numStrings; s++)
+    {
+        b->waveLength[s] = (b->sampleRate/b->freq[s]) - 1;
+        b->wlDest[s] = b->waveLength[s];
+    }
+}
+
+//////////---------------------------
+
+/* Modal Bank */
+
+#define MODALBANK_NUM_PARAMS 8
+
+void    tModalBank_init(tModalBank* const bank, int maxModes, LEAF* const leaf)
+{
+    tModalBank_initToPool(bank, maxModes, &leaf->mempool);
+}
+
+void    tModalBank_initToPool(tModalBank* const bank, int maxModes, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tModalBank* b = *bank = (_tModalBank*) mpool_alloc(sizeof(_tModalBank), m);
+    b->mempool = m;
+    LEAF* leaf = b->mempool->leaf;
+    
+    if (maxModes < 1) maxModes = 1;
+    b->maxModes = maxModes;
+    b->numModes = maxModes;
+    
+    int size = ((maxModes + MODALBANK_LANES - 1) / MODALBANK_LANES) * MODALBANK_LANES;
+    b->modes = (float*) mpool_calloc(sizeof(float) * size * MODALBANK_NUM_PARAMS, m);
+    b->ratio   = b->modes;
+    b->decay   = b->modes + size;
+    b->amp     = b->modes + size * 2;
+    b->coeffRe = b->modes + size * 3;
+    b->coeffIm = b->modes + size * 4;
+    b->gain    = b->modes + size * 5;
+    b->stateRe = b->modes + size * 6;
+    b->stateIm = b->modes + size * 7;
+    
+    b->accum = (float*) mpool_alloc(sizeof(float) * MODALBANK_CHUNK * MODALBANK_LANES, m);
+    
+    b->fundamental = 220.0f;
+    b->decayScale = 1.0f;
+    b->sampleRate = leaf->sampleRate;
+    b->invSampleRate = leaf->invSampleRate;
+    
+    // harmonic modes with a gentle rolloff until a table is set
+    for (int i = 0; i < maxModes; i++)
+    {
+        b->ratio[i] = (float) (i + 1);
+        b->decay[i] = 1.0f;
+        b->amp[i] = 1.0f / (i + 1);
+    }
+    tModalBank_setFundamental(bank, b->fundamental);
+}
+
+void    tModalBank_free(tModalBank* const bank)
+{
+    _tModalBank* b = *bank;
+    
+    mpool_free((char*)b->accum, b->mempool);
+    mpool_free((char*)b->modes, b->mempool);
+    mpool_free((char*)b, b->mempool);
+}
+
+static void modalBankUpdate(_tModalBank* b, int i)
+{
+    float freq = b->ratio[i] * b->fundamental;
+    float t60 = b->decay[i] * b->decayScale;
+    
+    if (i >= b->numModes || freq <= 0.0f || freq >= b->sampleRate * 0.5f || t60 <= 0.0f)
+    {
+        // muted modes ring down at once and add nothing to the output
+        b->coeffRe[i] = 0.0f;
+        b->coeffIm[i] = 0.0f;
+        b->gain[i] = 0.0f;
+        return;
+    }
+    
+    float r = powf(0.001f, b->invSampleRate / t60);
+    float w = TWO_PI * freq * b->invSampleRate;
+    b->coeffRe[i] = r * cosf(w);
+    b->coeffIm[i] = r * sinf(w);
+    b->gain[i] = b->amp[i];
+}
+
+// Each mode is a complex one-pole, which is a two-pole resonator on its imaginary
+// part and stays accurate for low, slowly decaying modes. Modes are run in groups of
+// MODALBANK_LANES with one accumulator per lane, so the inner loop has no dependency
+// between lanes and the lanes are only summed once per sample at the end of a chunk.
+static void modalBankProcess(_tModalBank* b, float* input, float* output, int numSamples)
+{
+    int numGroups = (b->numModes + MODALBANK_LANES - 1) / MODALBANK_LANES;
+    float* acc = b->accum;
+    
+    while (numSamples > 0)
+    {
+        int n = (numSamples < MODALBANK_CHUNK) ? numSamples : MODALBANK_CHUNK;
+        
+        for (int i = 0; i < n * MODALBANK_LANES; i++) acc[i] = 0.0f;
+        
+        for (int g = 0; g < numGroups; g++)
+        {
+            int base = g * MODALBANK_LANES;
+            float re[MODALBANK_LANES], im[MODALBANK_LANES];
+            float cr[MODALBANK_LANES], ci[MODALBANK_LANES], gain[MODALBANK_LANES];
+            for (int l = 0; l < MODALBANK_LANES; l++)
+            {
+                re[l] = b->stateRe[base + l];
+                im[l] = b->stateIm[base + l];
+                cr[l] = b->coeffRe[base + l];
+                ci[l] = b->coeffIm[base + l];
+                gain[l] = b->gain[base + l];
+            }
+            
+            for (int i = 0; i < n; i++)
+            {
+                float x = (input != NULL) ? input[i] : 0.0f;
+                float* a = &acc[i * MODALBANK_LANES];
+                for (int l = 0; l < MODALBANK_LANES; l++)
+                {
+                    float r = re[l];
+                    float q = im[l];
+                    re[l] = cr[l] * r - ci[l] * q + x;
+                    im[l] = ci[l] * r + cr[l] * q;
+                    a[l] += gain[l] * im[l];
+                }
+            }
+            
+            for (int l = 0; l < MODALBANK_LANES; l++)
+            {
+#if !LEAF_NO_DENORMAL_CHECK
+                // flush modes that have rung out before they turn denormal
+                if (fabsf(re[l]) + fabsf(im[l]) < 1e-20f) re[l] = im[l] = 0.0f;
+#endif
+                b->stateRe[base + l] = re[l];
+                b->stateIm[base + l] = im[l];
+            }
+        }
+        
+        for (int i = 0; i < n; i++)
+        {
+            float sum = 0.0f;
+            for (int l = 0; l < MODALBANK_LANES; l++) sum += acc[i * MODALBANK_LANES + l];
+            output[i] = sum;
+        }
+        
+        if (input != NULL) input += n;
+        output += n;
+        numSamples -= n;
+    }
+}
+
+float   tModalBank_tick(tModalBank* const bank, float input)
+{
+    _tModalBank* b = *bank;
+    
+    float output;
+    modalBankProcess(b, &input, &output, 1);
+    return output;
+}
+
+void    tModalBank_tickBlock(tModalBank* const bank, float* input, float* output, int numSamples)
+{
+    _tModalBank* b = *bank;
+    modalBankProcess(b, input, output, numSamples);
+}
+
+void    tModalBank_clear(tModalBank* const bank)
+{
+    _tModalBank* b = *bank;
+    
+    for (int i = 0; i < b->maxModes; i++)
+    {
+        b->stateRe[i] = 0.0f;
+        b->stateIm[i] = 0.0f;
+    }
+}
+
+void    tModalBank_setModes(tModalBank* const bank, float* ratios, float* decays, float* gains, int numModes)
+{
+    _tModalBank* b = *bank;
+    
+    if (numModes > b->maxModes) numModes = b->maxModes;
+    else if (numModes < 0) numModes = 0;
+    
+    for (int i = 0; i < numModes; i++)
+    {
+        b->ratio[i] = ratios[i];
+        if (decays != NULL) b->decay[i] = decays[i];
+        if (gains != NULL) b->amp[i] = gains[i];
+    }
+    tModalBank_setNumModes(bank, numModes);
+}
+
+void    tModalBank_setMode(tModalBank* const bank, int mode, float ratio, float decay, float gain)
+{
+    _tModalBank* b = *bank;
+    
+    if (mode < 0 || mode >= b->maxModes) return;
+    b->ratio[mode] = ratio;
+    b->decay[mode] = decay;
+    b->amp[mode] = gain;
+    modalBankUpdate(b, mode);
+}
+
+void    tModalBank_setNumModes(tModalBank* const bank, int numModes)
+{
+    _tModalBank* b = *bank;
+    
+    if (numModes > b->maxModes) numModes = b->maxModes;
+    else if (numModes < 0) numModes = 0;
+    b->numModes = numModes;
+    
+    for (int i = 0; i < b->maxModes; i++)
+    {
+        modalBankUpdate(b, i);
+        if (i >= numModes) b->stateRe[i] = b->stateIm[i] = 0.0f;
+    }
+}
+
+void    tModalBank_setFundamental(tModalBank* const bank, float freq)
+{
+    _tModalBank* b = *bank;
+    
+    b->fundamental = freq;
+    for (int i = 0; i < b->numModes; i++) modalBankUpdate(b, i);
+}
+
+void    tModalBank_setDecayScale(tModalBank* const bank, float scale)
+{
+    _tModalBank* b = *bank;
+    
+    if (scale < 0.0f) scale = 0.0f;
+    b->decayScale = scale;
+    for (int i = 0; i < b->numModes; i++) modalBankUpdate(b, i);
+}
+
+void    tModalBank_setSampleRate(tModalBank* const bank, float sr)
+{
+    _tModalBank* b = *bank;
+    
+    b->sampleRate = sr;
+    b->invSampleRate = 1.0f/sr;
+    for (int i = 0; i < b->numModes; i++) modalBankUpdate(b, i);
+}
+
 ///Reed Table model
 //default values from STK are 0.6 offset and -0.8 slope
 
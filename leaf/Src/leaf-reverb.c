@@ -957,3 +957,650 @@ void    tDattorroReverb_setSampleRate   (tDattorroReverb* const rev, float sr)
     tDattorroReverb_setFeedbackFilter(rev, r->feedback_filter);
     tDattorroReverb_setFeedbackGain(rev, r->feedback_gain);
 }
+
+// ======================================DATTORRO BLOCK=========================================
+
+static const float dattorro_block_taps[14] =
+{
+    8.9f, 99.8f, 64.2f, 67.f, 66.8f, 6.3f, 35.8f,
+    11.8f, 121.7f, 6.3f, 89.7f, 70.8f, 11.2f, 4.1f
+};
+
+static void dattorroBlockAllocate(_tDattorroReverbBlock* r)
+{
+    float tmax = r->size_max * r->sampleRate * 0.001f;
+    float t1 = r->sampleRate * 0.001f;
+    
+    uint32_t in_delay_size = LEAF_nextPowerOfTwo((uint32_t)(200.f * tmax) + 2);
+    uint32_t in_ap_size = LEAF_nextPowerOfTwo((uint32_t)(12.73f * t1) + 2);
+    uint32_t ap_size = LEAF_nextPowerOfTwo((uint32_t)(34.51f * tmax) + 3);
+    uint32_t d1_size = LEAF_nextPowerOfTwo((uint32_t)(149.62f * tmax) + 3);
+    uint32_t d2_size = LEAF_nextPowerOfTwo((uint32_t)(89.24f * tmax) + 3);
+    uint32_t d3_size = LEAF_nextPowerOfTwo((uint32_t)(125.f * tmax) + 3);
+    
+    r->memSize = in_delay_size + 4 * in_ap_size + 2 * (ap_size + d1_size + d2_size + d3_size);
+    r->mem = (float*) mpool_alloc(sizeof(float) * r->memSize, r->mempool);
+    
+    float* p = r->mem;
+    r->in_delay = p; p += in_delay_size;
+    r->in_delay_mask = in_delay_size - 1;
+    for (int i = 0; i < 4; i++)
+    {
+        r->in_ap[i] = p; p += in_ap_size;
+        r->in_ap_length[i] = in_allpass_delays[i] * t1;
+        r->in_ap_gain[i] = in_allpass_gains[i];
+    }
+    r->in_ap_mask = in_ap_size - 1;
+    for (int k = 0; k < 2; k++)
+    {
+        r->ap[k] = p; p += ap_size;
+        r->d1[k] = p; p += d1_size;
+        r->d2[k] = p; p += d2_size;
+        r->d3[k] = p; p += d3_size;
+    }
+    r->ap_mask = ap_size - 1;
+    r->d1_mask = d1_size - 1;
+    r->d2_mask = d2_size - 1;
+    r->d3_mask = d3_size - 1;
+    
+    tDattorroReverbBlock_clear(&r);
+}
+
+void    tDattorroReverbBlock_init              (tDattorroReverbBlock* const rev, LEAF* const leaf)
+{
+    tDattorroReverbBlock_initToPool(rev, &leaf->mempool);
+}
+
+void    tDattorroReverbBlock_initToPool        (tDattorroReverbBlock* const rev, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tDattorroReverbBlock* r = *rev = (_tDattorroReverbBlock*) mpool_alloc(sizeof(_tDattorroReverbBlock), m);
+    r->mempool = m;
+    LEAF* leaf = r->mempool->leaf;
+    
+    r->sampleRate = leaf->sampleRate;
+    
+    r->size_max = 2.0f;
+    r->size = 1.f;
+    r->t = r->size * r->sampleRate * 0.001f;
+    r->frozen = 0;
+    r->writePos = 0;
+    
+    dattorroBlockAllocate(r);
+    
+    r->lfo_phase[0] = 0.0f;
+    r->lfo_phase[1] = 0.0f;
+    tDattorroReverbBlock_setFreeze(rev, 0);
+    
+    tDattorroReverbBlock_setSize(rev, 0.5f);
+    // start the tank delays at their targets rather than gliding from zero
+    for (int k = 0; k < 2; k++)
+    {
+        r->ap_delay[k] = r->ap_base[k];
+        for (int j = 0; j < 3; j++) r->d_delay[k][j] = r->d_target[k][j];
+    }
+    
+    // PARAMETERS
+    tDattorroReverbBlock_setMix(rev, 0.5f);
+    tDattorroReverbBlock_setInputDelay(rev,  0.f);
+    tDattorroReverbBlock_setInputFilter(rev, 10000.f);
+    tDattorroReverbBlock_setFeedbackFilter(rev, 5000.f);
+    tDattorroReverbBlock_setFeedbackGain(rev, 0.4f);
+    tDattorroReverbBlock_setHP(rev, 20.f);
+}
+
+void    tDattorroReverbBlock_free              (tDattorroReverbBlock* const rev)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    mpool_free((char*)r->mem, r->mempool);
+    mpool_free((char*)r, r->mempool);
+}
+
+void    tDattorroReverbBlock_clear             (tDattorroReverbBlock* const rev)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    memset(r->mem, 0, sizeof(float) * r->memSize);
+    
+    r->in_lp = 0.0f;
+    for (int i = 0; i < 4; i++) r->in_ap_last[i] = 0.0f;
+    for (int k = 0; k < 2; k++)
+    {
+        r->ap_last[k] = 0.0f;
+        r->lp[k] = 0.0f;
+        r->hp_xs[k] = 0.0f;
+        r->hp_ys[k] = 0.0f;
+        r->d2_last[k] = 0.0f;
+    }
+}
+
+// linearly interpolated read from a masked line, delay in samples behind the write position
+static inline float dattorroBlockRead(float* buff, uint32_t mask, uint32_t writePos, float delay)
+{
+    uint32_t idelay = (uint32_t) delay;
+    float alpha = delay - (float) idelay;
+    float a = buff[(writePos - idelay) & mask];
+    float b = buff[(writePos - idelay - 1) & mask];
+    return a + alpha * (b - a);
+}
+
+// 4-point Hermite read at a fixed fraction, matching tTapeDelay_tapOut, with the
+// weights worked out once in setSize
+static inline float dattorroBlockTap(float* buff, uint32_t mask, uint32_t writePos, uint32_t tap, const float* w)
+{
+    uint32_t i = writePos - tap;
+    return w[0] * buff[(i - 1) & mask] + w[1] * buff[i & mask]
+    + w[2] * buff[(i + 1) & mask] + w[3] * buff[(i + 2) & mask];
+}
+
+// renders up to DATTORRO_BLOCK_CHUNK samples of wet signal
+static void dattorroBlockProcessChunk(_tDattorroReverbBlock* r, float* input, float* wetL, float* wetR, int n)
+{
+    float invN = 1.0f / (float) n;
+    float apInc[2];
+    float dInc[2][3];
+    float maxSlew = 0.25f * (float) n;
+    
+    // modulation and size changes are updated once per chunk and ramped per sample
+    for (int k = 0; k < 2; k++)
+    {
+        r->lfo_phase[k] += r->lfo_inc[k] * (float) n;
+        if (r->lfo_phase[k] >= 1.0f) r->lfo_phase[k] -= 1.0f;
+        float target = r->ap_base[k] + sinf(TWO_PI * r->lfo_phase[k]) * r->ap_depth;
+        apInc[k] = (target - r->ap_delay[k]) * invN;
+        
+        for (int j = 0; j < 3; j++)
+        {
+            float delta = LEAF_clip(-maxSlew, r->d_target[k][j] - r->d_delay[k][j], maxSlew);
+            dInc[k][j] = delta * invN;
+        }
+    }
+    
+    float in_a1 = 1.0f - r->in_b0;
+    float fb_a1 = 1.0f - r->fb_b0;
+    float g = r->ap_gain;
+    uint32_t wp = r->writePos;
+    
+    for (int i = 0; i < n; i++)
+    {
+        float x = r->frozen ? 0.0f : input[i];
+        
+        // INPUT
+        r->in_delay[wp & r->in_delay_mask] = x;
+        float s = dattorroBlockRead(r->in_delay, r->in_delay_mask, wp, r->in_delay_length);
+        
+        r->in_lp = r->in_b0 * s + in_a1 * r->in_lp;
+        s = r->in_lp;
+        
+        for (int j = 0; j < 4; j++)
+        {
+            float s1 = s - r->in_ap_gain[j] * r->in_ap_last[j];
+            r->in_ap[j][wp & r->in_ap_mask] = s1;
+            float y = dattorroBlockRead(r->in_ap[j], r->in_ap_mask, wp, r->in_ap_length[j]) + r->in_ap_gain[j] * s;
+            r->in_ap_last[j] = y;
+            s = y;
+        }
+        
+        // TANK, each lane is fed by the other lane's output
+        float tail[2];
+        tail[0] = dattorroBlockRead(r->d3[0], r->d3_mask, wp, r->d_delay[0][2]);
+        tail[1] = dattorroBlockRead(r->d3[1], r->d3_mask, wp, r->d_delay[1][2]);
+        
+        for (int k = 0; k < 2; k++)
+        {
+            float y = s + tail[1 - k];
+            
+            float s1 = y - g * r->ap_last[k];
+            r->ap[k][wp & r->ap_mask] = s1;
+            y = dattorroBlockRead(r->ap[k], r->ap_mask, wp, r->ap_delay[k]) + g * y;
+            r->ap_last[k] = y;
+            
+            r->d1[k][wp & r->d1_mask] = y;
+            y = dattorroBlockRead(r->d1[k], r->d1_mask, wp, r->d_delay[k][0]);
+            
+            r->lp[k] = r->fb_b0 * y + fb_a1 * r->lp[k];
+            y = r->lp[k] + r->d2_last[k] * 0.5f;
+            
+            r->d2[k][wp & r->d2_mask] = y * 0.5f;
+            r->d2_last[k] = dattorroBlockRead(r->d2[k], r->d2_mask, wp, r->d_delay[k][1]);
+            y = r->d2_last[k] + y;
+            
+            r->hp_ys[k] = y - r->hp_xs[k] + r->hp_R * r->hp_ys[k];
+            r->hp_xs[k] = y;
+            
+            r->d3[k][wp & r->d3_mask] = r->hp_ys[k] * r->feedback_gain;
+            
+            r->ap_delay[k] += apInc[k];
+            r->d_delay[k][0] += dInc[k][0];
+            r->d_delay[k][1] += dInc[k][1];
+            r->d_delay[k][2] += dInc[k][2];
+        }
+        
+        // TAP OUT 1
+        float l = dattorroBlockTap(r->d1[0], r->d1_mask, wp, r->tap[0], r->tap_w[0])
+        + dattorroBlockTap(r->d1[0], r->d1_mask, wp, r->tap[1], r->tap_w[1]);
+        l -= dattorroBlockTap(r->d2[0], r->d2_mask, wp, r->tap[2], r->tap_w[2]);
+        l += dattorroBlockTap(r->d3[0], r->d3_mask, wp, r->tap[3], r->tap_w[3]);
+        l -= dattorroBlockTap(r->d1[1], r->d1_mask, wp, r->tap[4], r->tap_w[4]);
+        l -= dattorroBlockTap(r->d2[1], r->d2_mask, wp, r->tap[5], r->tap_w[5]);
+        l -= dattorroBlockTap(r->d3[1], r->d3_mask, wp, r->tap[6], r->tap_w[6]);
+        
+        // TAP OUT 2
+        float rr = dattorroBlockTap(r->d1[1], r->d1_mask, wp, r->tap[7], r->tap_w[7])
+        + dattorroBlockTap(r->d1[1], r->d1_mask, wp, r->tap[8], r->tap_w[8]);
+        rr -= dattorroBlockTap(r->d2[1], r->d2_mask, wp, r->tap[9], r->tap_w[9]);
+        rr += dattorroBlockTap(r->d3[1], r->d3_mask, wp, r->tap[10], r->tap_w[10]);
+        rr -= dattorroBlockTap(r->d1[0], r->d1_mask, wp, r->tap[11], r->tap_w[11]);
+        rr -= dattorroBlockTap(r->d2[0], r->d2_mask, wp, r->tap[12], r->tap_w[12]);
+        rr -= dattorroBlockTap(r->d3[0], r->d3_mask, wp, r->tap[13], r->tap_w[13]);
+        
+        wetL[i] = l * 0.14f;
+        wetR[i] = rr * 0.14f;
+        
+        wp++;
+    }
+    
+    r->writePos = wp;
+}
+
+void    tDattorroReverbBlock_tickBlock         (tDattorroReverbBlock* const rev, float* input, float* output, int numSamples)
+{
+    _tDattorroReverbBlock* r = *rev;
+    float wetL[DATTORRO_BLOCK_CHUNK];
+    float wetR[DATTORRO_BLOCK_CHUNK];
+    
+    for (int offset = 0; offset < numSamples; offset += DATTORRO_BLOCK_CHUNK)
+    {
+        int n = numSamples - offset;
+        if (n > DATTORRO_BLOCK_CHUNK) n = DATTORRO_BLOCK_CHUNK;
+        
+        dattorroBlockProcessChunk(r, &input[offset], wetL, wetR, n);
+        
+        float dry = 1.0f - r->mix;
+        for (int i = 0; i < n; i++)
+        {
+            output[offset + i] = input[offset + i] * dry + (wetL[i] + wetR[i]) * 0.5f * r->mix;
+        }
+    }
+}
+
+void    tDattorroReverbBlock_tickStereoBlock   (tDattorroReverbBlock* const rev, float* input, float* outputL, float* outputR, int numSamples)
+{
+    _tDattorroReverbBlock* r = *rev;
+    float wetL[DATTORRO_BLOCK_CHUNK];
+    float wetR[DATTORRO_BLOCK_CHUNK];
+    
+    for (int offset = 0; offset < numSamples; offset += DATTORRO_BLOCK_CHUNK)
+    {
+        int n = numSamples - offset;
+        if (n > DATTORRO_BLOCK_CHUNK) n = DATTORRO_BLOCK_CHUNK;
+        
+        dattorroBlockProcessChunk(r, &input[offset], wetL, wetR, n);
+        
+        float dryGain = 1.0f - r->mix;
+        for (int i = 0; i < n; i++)
+        {
+            float dry = input[offset + i] * dryGain;
+            outputL[offset + i] = dry + wetL[i] * r->mix;
+            outputR[offset + i] = dry + wetR[i] * r->mix;
+        }
+    }
+}
+
+void    tDattorroReverbBlock_setMix            (tDattorroReverbBlock* const rev, float mix)
+{
+    _tDattorroReverbBlock* r = *rev;
+    r->mix = LEAF_clip(0.0f, mix, 1.0f);
+}
+
+void    tDattorroReverbBlock_setFreeze         (tDattorroReverbBlock* const rev, int freeze)
+{
+    _tDattorroReverbBlock* r = *rev;
+    r->frozen = freeze;
+    if (freeze)
+    {
+        r->ap_gain = 1.0f;
+        r->lfo_inc[0] = 0.0f;
+        r->lfo_inc[1] = 0.0f;
+    }
+    else
+    {
+        r->ap_gain = 0.7f;
+        r->lfo_inc[0] = 0.1f / r->sampleRate;
+        r->lfo_inc[1] = 0.07f / r->sampleRate;
+    }
+}
+
+void    tDattorroReverbBlock_setHP             (tDattorroReverbBlock* const rev, float freq)
+{
+    _tDattorroReverbBlock* r = *rev;
+    r->hp_freq = LEAF_clip(20.0f, freq, 20000.0f);
+    r->hp_R = 1.0f - (r->hp_freq * TWO_PI / r->sampleRate);
+}
+
+void    tDattorroReverbBlock_setSize           (tDattorroReverbBlock* const rev, float size)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    r->size = LEAF_clip(0.01f, size*r->size_max, r->size_max);
+    r->t = r->size * r->sampleRate * 0.001f;
+    
+    r->ap_base[0] = SAMP(30.51f);
+    r->ap_base[1] = SAMP(22.58f);
+    r->ap_depth = SAMP(4.0f);
+    
+    r->d_target[0][0] = SAMP(141.69f);
+    r->d_target[0][1] = SAMP(89.24f);
+    r->d_target[0][2] = SAMP(125.f);
+    r->d_target[1][0] = SAMP(149.62f);
+    r->d_target[1][1] = SAMP(60.48f);
+    r->d_target[1][2] = SAMP(106.28f);
+    
+    for (int i = 0; i < 14; i++)
+    {
+        // the Hermite points straddle the tap, x of the way from the older to the newer
+        float delay = SAMP(dattorro_block_taps[i]);
+        uint32_t older = (uint32_t) ceilf(delay);
+        float x = (float) older - delay;
+        float x2 = x * x;
+        float x3 = x2 * x;
+        r->tap[i] = older;
+        r->tap_w[i][0] = -0.5f * x3 + x2 - 0.5f * x;
+        r->tap_w[i][1] = 1.5f * x3 - 2.5f * x2 + 1.0f;
+        r->tap_w[i][2] = -1.5f * x3 + 2.0f * x2 + 0.5f * x;
+        r->tap_w[i][3] = 0.5f * x3 - 0.5f * x2;
+    }
+}
+
+void    tDattorroReverbBlock_setInputDelay     (tDattorroReverbBlock* const rev, float preDelay)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    r->predelay = LEAF_clip(0.0f, preDelay, 200.0f);
+    r->in_delay_length = SAMP(r->predelay);
+}
+
+void    tDattorroReverbBlock_setInputFilter    (tDattorroReverbBlock* const rev, float freq)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    r->input_filter = LEAF_clip(0.0f, freq, 20000.0f);
+    r->in_b0 = LEAF_clip(0.0f, r->input_filter * TWO_PI / r->sampleRate, 1.0f);
+}
+
+void    tDattorroReverbBlock_setFeedbackFilter (tDattorroReverbBlock* const rev, float freq)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    r->feedback_filter = LEAF_clip(0.0f, freq, 20000.0f);
+    r->fb_b0 = LEAF_clip(0.0f, r->feedback_filter * TWO_PI / r->sampleRate, 1.0f);
+}
+
+void    tDattorroReverbBlock_setFeedbackGain   (tDattorroReverbBlock* const rev, float gain)
+{
+    _tDattorroReverbBlock* r = *rev;
+    r->feedback_gain = gain;
+}
+
+void    tDattorroReverbBlock_setSampleRate     (tDattorroReverbBlock* const rev, float sr)
+{
+    _tDattorroReverbBlock* r = *rev;
+    
+    mpool_free((char*)r->mem, r->mempool);
+    
+    r->sampleRate = sr;
+    dattorroBlockAllocate(r);
+    
+    tDattorroReverbBlock_setFreeze(rev, r->frozen);
+    
+    tDattorroReverbBlock_setSize(rev, r->size / r->size_max);
+    for (int k = 0; k < 2; k++)
+    {
+        r->ap_delay[k] = r->ap_base[k];
+        for (int j = 0; j < 3; j++) r->d_delay[k][j] = r->d_target[k][j];
+    }
+    tDattorroReverbBlock_setInputDelay(rev, r->predelay);
+    tDattorroReverbBlock_setInputFilter(rev, r->input_filter);
+    tDattorroReverbBlock_setFeedbackFilter(rev, r->feedback_filter);
+    tDattorroReverbBlock_setHP(rev, r->hp_freq);
+}
+
+// ======================================FDN=========================================
+
+#define FDN_MIN_LENGTH_MS 23.0f
+#define FDN_MAX_LENGTH_MS 79.0f
+
+static void fdnAllocate(_tFDNReverb* r)
+{
+    r->stride = LEAF_nextPowerOfTwo((uint32_t)(FDN_MAX_LENGTH_MS * 0.001f * r->sampleRate) + 64);
+    r->mask = r->stride - 1;
+    r->buff = (float*) mpool_calloc(sizeof(float) * r->stride * r->numLines, r->mempool);
+    r->writePos = 0;
+}
+
+void    tFDNReverb_init                 (tFDNReverb* const rev, int numLines, LEAF* const leaf)
+{
+    tFDNReverb_initToPool(rev, numLines, &leaf->mempool);
+}
+
+void    tFDNReverb_initToPool           (tFDNReverb* const rev, int numLines, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tFDNReverb* r = *rev = (_tFDNReverb*) mpool_alloc(sizeof(_tFDNReverb), m);
+    r->mempool = m;
+    LEAF* leaf = r->mempool->leaf;
+    
+    // the Hadamard transform needs a power of two number of lines
+    if (numLines < 4) numLines = 4;
+    if (numLines > FDN_MAX_LINES) numLines = FDN_MAX_LINES;
+    r->numLines = LEAF_nextPowerOfTwo(numLines);
+    
+    r->sampleRate = leaf->sampleRate;
+    r->invSampleRate = leaf->invSampleRate;
+    
+    r->matrix = FDNHadamard;
+    
+    for (int i = 0; i < r->numLines; i++)
+    {
+        r->inGain[i] = (i & 1) ? -1.0f : 1.0f;
+        r->outGain[i] = (i & 2) ? -1.0f : 1.0f;
+        r->lowpassState[i] = 0.0f;
+    }
+    
+    fdnAllocate(r);
+    
+    r->t60 = 2.0f;
+    r->mix = 0.3f;
+    tFDNReverb_setSize(rev, 1.0f);
+    tFDNReverb_setDamping(rev, 8000.0f);
+}
+
+void    tFDNReverb_free                 (tFDNReverb* const rev)
+{
+    _tFDNReverb* r = *rev;
+    
+    mpool_free((char*)r->buff, r->mempool);
+    mpool_free((char*)r, r->mempool);
+}
+
+void    tFDNReverb_clear                (tFDNReverb* const rev)
+{
+    _tFDNReverb* r = *rev;
+    
+    memset(r->buff, 0, sizeof(float) * r->stride * r->numLines);
+    for (int i = 0; i < r->numLines; i++) r->lowpassState[i] = 0.0f;
+}
+
+static void fdnProcess(_tFDNReverb* r, float* input, float** outputs, int numChannels, int numSamples)
+{
+    int N = r->numLines;
+    float v[FDN_MAX_LINES];
+    float wet[FDN_MAX_LINES];
+    float norm = 1.0f / sqrtf((float) N);
+    float outNorm = sqrtf((float) numChannels / (float) N);
+    float dry = 1.0f - r->mix;
+    float d = r->dampingCoeff;
+    uint32_t wp = r->writePos;
+    
+    for (int n = 0; n < numSamples; n++)
+    {
+        float x = input[n];
+        
+        for (int i = 0; i < N; i++)
+        {
+            v[i] = r->buff[i * r->stride + ((wp - r->length[i]) & r->mask)];
+            wet[i] = v[i] * r->outGain[i];
+        }
+        
+        // damping and decay
+        for (int i = 0; i < N; i++)
+        {
+            r->lowpassState[i] = v[i] + d * (r->lowpassState[i] - v[i]);
+            v[i] = r->lowpassState[i] * r->decay[i];
+        }
+        
+        // feedback matrix
+        if (r->matrix == FDNHadamard)
+        {
+            for (int h = 1; h < N; h <<= 1)
+            {
+                for (int i = 0; i < N; i += (h << 1))
+                {
+                    for (int j = i; j < i + h; j++)
+                    {
+                        float a = v[j];
+                        float b = v[j + h];
+                        v[j] = a + b;
+                        v[j + h] = a - b;
+                    }
+                }
+            }
+            for (int i = 0; i < N; i++) v[i] *= norm;
+        }
+        else
+        {
+            float sum = 0.0f;
+            for (int i = 0; i < N; i++) sum += v[i];
+            sum *= 2.0f / (float) N;
+            for (int i = 0; i < N; i++) v[i] -= sum;
+        }
+        
+        for (int i = 0; i < N; i++)
+        {
+            r->buff[i * r->stride + (wp & r->mask)] = v[i] + x * r->inGain[i] * norm;
+        }
+        
+        for (int c = 0; c < numChannels; c++)
+        {
+            float sum = 0.0f;
+            for (int i = c; i < N; i += numChannels) sum += wet[i];
+            outputs[c][n] = x * dry + sum * outNorm * r->mix;
+        }
+        
+        wp++;
+    }
+    
+    r->writePos = wp;
+}
+
+float   tFDNReverb_tick                 (tFDNReverb* const rev, float input)
+{
+    _tFDNReverb* r = *rev;
+    float out;
+    float* outputs[1] = { &out };
+    fdnProcess(r, &input, outputs, 1, 1);
+    return out;
+}
+
+void    tFDNReverb_tickBlock            (tFDNReverb* const rev, float* input, float* output, int numSamples)
+{
+    _tFDNReverb* r = *rev;
+    float* outputs[1] = { output };
+    fdnProcess(r, input, outputs, 1, numSamples);
+}
+
+void    tFDNReverb_tickStereoBlock      (tFDNReverb* const rev, float* input, float* outputL, float* outputR, int numSamples)
+{
+    _tFDNReverb* r = *rev;
+    float* outputs[2] = { outputL, outputR };
+    fdnProcess(r, input, outputs, 2, numSamples);
+}
+
+void    tFDNReverb_tickMultichannelBlock(tFDNReverb* const rev, float* input, float** outputs, int numChannels, int numSamples)
+{
+    _tFDNReverb* r = *rev;
+    if (numChannels < 1) return;
+    if (numChannels > r->numLines) numChannels = r->numLines;
+    fdnProcess(r, input, outputs, numChannels, numSamples);
+}
+
+void    tFDNReverb_setT60               (tFDNReverb* const rev, float t60)
+{
+    _tFDNReverb* r = *rev;
+    
+    if (t60 <= 0.0f) t60 = 0.001f;
+    
+    r->t60 = t60;
+    
+    for (int i = 0; i < r->numLines; i++)
+    {
+        r->decay[i] = powf(10.0f, (-3.0f * (float)r->length[i] * r->invSampleRate / r->t60));
+    }
+}
+
+void    tFDNReverb_setDamping           (tFDNReverb* const rev, float freq)
+{
+    _tFDNReverb* r = *rev;
+    
+    r->damping = LEAF_clip(20.0f, freq, r->sampleRate * 0.5f);
+    r->dampingCoeff = expf(-TWO_PI * r->damping * r->invSampleRate);
+}
+
+void    tFDNReverb_setSize              (tFDNReverb* const rev, float size)
+{
+    _tFDNReverb* r = *rev;
+    
+    r->size = LEAF_clip(0.1f, size, 1.0f);
+    
+    // geometrically spaced prime lengths keep the echo pattern from piling up
+    float ratio = FDN_MAX_LENGTH_MS / FDN_MIN_LENGTH_MS;
+    for (int i = 0; i < r->numLines; i++)
+    {
+        float ms = FDN_MIN_LENGTH_MS * powf(ratio, (float)i / (float)(r->numLines - 1));
+        uint32_t length = (uint32_t) (ms * 0.001f * r->sampleRate * r->size);
+        while (!LEAF_isPrime(length)) length++;
+        if (length > r->mask) length = r->mask;
+        r->length[i] = length;
+    }
+    
+    tFDNReverb_setT60(rev, r->t60);
+}
+
+void    tFDNReverb_setMatrix            (tFDNReverb* const rev, FDNMatrix matrix)
+{
+    _tFDNReverb* r = *rev;
+    r->matrix = matrix;
+}
+
+void    tFDNReverb_setMix               (tFDNReverb* const rev, float mix)
+{
+    _tFDNReverb* r = *rev;
+    r->mix = LEAF_clip(0.0f, mix, 1.0f);
+}
+
+void    tFDNReverb_setSampleRate        (tFDNReverb* const rev, float sr)
+{
+    _tFDNReverb* r = *rev;
+    
+    mpool_free((char*)r->buff, r->mempool);
+    
+    r->sampleRate = sr;
+    r->invSampleRate = 1.0f / sr;
+    
+    fdnAllocate(r);
+    for (int i = 0; i < r->numLines; i++) r->lowpassState[i] = 0.0f;
+    
+    tFDNReverb_setSize(rev, r->size);
+    tFDNReverb_setDamping(rev, r->damping);
+}
@@ -1568,3 +1568,202 @@ void tMBSampler_setRate      (tMBSampler* const sp, float rate)
     p->_w = rate;
 }
 
+
+//================================tGranulator=====================================
+
+void tGranulator_init(tGranulator* const gr, tBuffer* const b, int maxGrains, LEAF* const leaf)
+{
+    tGranulator_initToPool(gr, b, maxGrains, &leaf->mempool);
+}
+
+void tGranulator_initToPool(tGranulator* const gr, tBuffer* const b, int maxGrains, tMempool* const mp)
+{
+    _tMempool* m = *mp;
+    _tGranulator* g = *gr = (_tGranulator*) mpool_alloc(sizeof(_tGranulator), m);
+    g->mempool = m;
+    LEAF* leaf = g->mempool->leaf;
+    
+    if (maxGrains < 1) maxGrains = 1;
+    g->maxGrains = maxGrains;
+    g->numActive = 0;
+    
+    g->pos = (float*) mpool_alloc(sizeof(float) * maxGrains, m);
+    g->rate = (float*) mpool_alloc(sizeof(float) * maxGrains, m);
+    g->phase = (float*) mpool_alloc(sizeof(float) * maxGrains, m);
+    g->phaseInc = (float*) mpool_alloc(sizeof(float) * maxGrains, m);
+    g->gain = (float*) mpool_alloc(sizeof(float) * maxGrains, m);
+    
+    // shared Hann window, with guard points so the interpolated read never needs a bounds check
+    for (int i = 0; i <= GRANULATOR_WINDOW_SIZE; i++)
+    {
+        g->window[i] = 0.5f - 0.5f * cosf(TWO_PI * (float)i / (float)GRANULATOR_WINDOW_SIZE);
+    }
+    g->window[GRANULATOR_WINDOW_SIZE] = 0.0f;
+    g->window[GRANULATOR_WINDOW_SIZE + 1] = 0.0f;
+    
+    g->invSampleRate = leaf->invSampleRate;
+    tGranulator_setSample(gr, b);
+}
+
+void tGranulator_free (tGranulator* const gr)
+{
+    _tGranulator* g = *gr;
+    
+    mpool_free((char*)g->gain, g->mempool);
+    mpool_free((char*)g->phaseInc, g->mempool);
+    mpool_free((char*)g->phase, g->mempool);
+    mpool_free((char*)g->rate, g->mempool);
+    mpool_free((char*)g->pos, g->mempool);
+    mpool_free((char*)g, g->mempool);
+}
+
+void tGranulator_setSample (tGranulator* const gr, tBuffer* const b)
+{
+    _tGranulator* g = *gr;
+    
+    g->samp = *b;
+    g->rateFactor = g->samp->sampleRate * g->invSampleRate;
+    g->numActive = 0;
+}
+
+int tGranulator_addGrain (tGranulator* const gr, float start, float length, float rate, float gain)
+{
+    _tGranulator* g = *gr;
+    
+    if (g->numActive >= g->maxGrains) return 0;
+    
+    uint32_t len = g->samp->recordedLength;
+    if (len < 2) return 0;
+    
+    if (isnan(start) || isinf(start) || isnan(rate) || isinf(rate) || isnan(length)) return 0;
+    
+    if (length < 1.0f) length = 1.0f;
+    
+    float flen = (float) len;
+    start = fmodf(start, flen);
+    if (start < 0.0f) start += flen;
+    if (start >= flen) start = 0.0f;
+    
+    int i = g->numActive++;
+    g->pos[i] = start;
+    g->rate[i] = rate * g->rateFactor;
+    g->phase[i] = 0.0f;
+    g->phaseInc[i] = 1.0f / length;
+    g->gain[i] = gain;
+    
+    return 1;
+}
+
+void tGranulator_tickBlock (tGranulator* const gr, float* output, int numSamples)
+{
+    _tGranulator* g = *gr;
+    
+    for (int n = 0; n < numSamples; n++) output[n] = 0.0f;
+    
+    float* buff = g->samp->buff;
+    int len = (int) g->samp->recordedLength;
+    if (len < 2)
+    {
+        g->numActive = 0;
+        return;
+    }
+    float flen = (float) len;
+    
+    int i = 0;
+    while (i < g->numActive)
+    {
+        float p = g->pos[i];
+        float r = g->rate[i];
+        float ph = g->phase[i];
+        float inc = g->phaseInc[i];
+        float amp = g->gain[i];
+        
+        // compute how many samples are left in this grain up front instead of testing every sample
+        float remaining = ceilf((1.0f - ph) / inc);
+        int run = numSamples;
+        int finished = 0;
+        if (remaining <= (float) numSamples)
+        {
+            run = (int) remaining;
+            finished = 1;
+        }
+        
+        for (int n = 0; n < run; n++)
+        {
+            float wp = ph * (float) GRANULATOR_WINDOW_SIZE;
+            int wi = (int) wp;
+            float wf = wp - (float) wi;
+            float w = g->window[wi] + wf * (g->window[wi+1] - g->window[wi]);
+            
+            int idx = (int) p;
+            float f = p - (float) idx;
+            // a tiny negative position wraps up to exactly flen after rounding
+            if (idx >= len) idx -= len;
+            int idx1 = idx + 1;
+            if (idx1 >= len) idx1 -= len;
+            float s = buff[idx] + f * (buff[idx1] - buff[idx]);
+            
+            output[n] += s * w * amp;
+            
+            ph += inc;
+            p += r;
+            if (p >= flen || p < 0.0f)
+            {
+                // fmodf rather than one subtraction, so rates past the buffer length still wrap
+                p = fmodf(p, flen);
+                if (p < 0.0f) p += flen;
+            }
+        }
+        
+        if (finished)
+        {
+            // swap the last active grain into this slot so active grains stay packed
+            int last = --g->numActive;
+            g->pos[i] = g->pos[last];
+            g->rate[i] = g->rate[last];
+            g->phase[i] = g->phase[last];
+            g->phaseInc[i] = g->phaseInc[last];
+            g->gain[i] = g->gain[last];
+        }
+        else
+        {
+            g->pos[i] = p;
+            g->phase[i] = ph;
+            i++;
+        }
+    }
+}
+
+float tGranulator_tick (tGranulator* const gr)
+{
+    float out;
+    tGranulator_tickBlock(gr, &out, 1);
+    return out;
+}
+
+void tGranulator_clear (tGranulator* const gr)
+{
+    _tGranulator* g = *gr;
+    g->numActive = 0;
+}
+
+int tGranulator_getNumActiveGrains (tGranulator* const gr)
+{
+    _tGranulator* g = *gr;
+    return g->numActive;
+}
+
+void tGranulator_setSampleRate (tGranulator* const gr, float sr)
+{
+    _tGranulator* g = *gr;
+    float oldFactor = g->rateFactor;
+    g->invSampleRate = 1.0f / sr;
+    g->rateFactor = g->samp->sampleRate * g->invSampleRate;
+    
+    // grains already playing keep their pitch at the new rate
+    if (oldFactor > 0.0f)
+    {
+        float scale = g->rateFactor / oldFactor;
+        for (int i = 0; i < g->numActive; i++) g->rate[i] *= scale;
+    }
+}
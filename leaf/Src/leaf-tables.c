@@ -50,6 +50,23 @@ const float* __leaf_tableref_firCoeffs[COEFFS_SIZE] = { __leaf_table_fir2XLow, _
 };
 
 const float __leaf_tablesize_firNumTaps[COEFFS_SIZE] = { 32, 64, 64, 128, 256, 256, 128, 256, 256, 512, 512, 1024 };
+
+// Allpass coefficients for polyphase IIR half-band filters, alternating between
+// the two branches. Each table is for the 2x stage whose output rate it names;
+// stages above 8x reuse the 8x table. Designed with the elliptic method from
+// Laurent de Soras' HIIR. Worst-case image rejection measured through tOversampler
+// for tones up to 0.44 fs: low 74 dB at every ratio, high 99 dB at 2x and 96 dB above.
+const float __leaf_table_halfband2XLow[6] = { 0.0682040760f, 0.2402703580f, 0.4486762359f, 0.6411223671f, 0.7999975637f, 0.9344822355f };
+const float __leaf_table_halfband4XLow[4] = { 0.0688332252f, 0.2522195603f, 0.5059969580f, 0.8133946666f };
+const float __leaf_table_halfband8XLow[3] = { 0.0850597639f, 0.3252398243f, 0.7173279130f };
+const float __leaf_table_halfband2XHigh[8] = { 0.0406334609f, 0.1505051290f, 0.3007570560f, 0.4607745050f, 0.6095243149f, 0.7385038411f, 0.8492238104f, 0.9497427837f };
+const float __leaf_table_halfband4XHigh[5] = { 0.0465691635f, 0.1751716445f, 0.3610064116f, 0.5838897102f, 0.8450784928f };
+const float __leaf_table_halfband8XHigh[4] = { 0.0518606215f, 0.2008454214f, 0.4370597872f, 0.7734333520f };
+
+const float* __leaf_tableref_halfbandCoeffs[HALFBAND_COEFFS_SIZE] = { __leaf_table_halfband2XLow, __leaf_table_halfband4XLow, __leaf_table_halfband8XLow, __leaf_table_halfband2XHigh, __leaf_table_halfband4XHigh, __leaf_table_halfband8XHigh
+};
+
+const int __leaf_tablesize_halfbandNumCoeffs[HALFBAND_COEFFS_SIZE] = { 6, 4, 3, 8, 5, 4 };
 #endif // LEAF_INCLUDE_OVERSAMPLER_TABLES
 
 #if LEAF_INCLUDE_SHAPER_TABLE
@@ -15818,3 +15835,17 @@ slope_dd_table [MINBLEP_PHASES * SLOPE_DD_PULSE_LENGTH + 1] =
     0.000000e+00
 } _CONSTANT_DATA_LOCATION;
 #endif // LEAF_INCLUDE_MINBLEP_TABLES
+
+#if LEAF_INCLUDE_ADAA_TABLES
+// Curves and their first and second antiderivatives sampled at ADAA_TABLE_SIZE
+// points, for tADAAShaper. LEAF_tanh over [-3, 3] and LEAF_shaper with a drive
+// of 0.25 over [-sqrt(2), sqrt(2)]; both are constant outside. The
+// antiderivatives are zero at 0. The second antiderivatives are doubles, since
+// second order ADAA takes second differences of them.
+const float __leaf_table_adaaTanh[ADAA_TABLE_SIZE] = { -1, -0.999999879, -0.999999024, -0.999996665, -0.999992002, -0.999984191, -0.999972352, -0.999955566, -0.999932868, -0.999903251, -0.999865663, -0.999819003, -0.999762123, -0.999693821, -0.999612846, -0.999517888, -0.999407583, -0.999280507, -0.999135174, -0.998970036, -0.998783479, -0.99857382, -0.998339306, -0.998078111, -0.997788336, -0.997467999, -0.997115041, -0.99672732, -0.996302604, -0.995838577, -0.995332828, -0.994782852, -0.994186047, -0.993539708, -0.992841031, -0.992087101, -0.991274895, -0.990401277, -0.989462995, -0.98845668, -0.987378837, -0.98622585, -0.984993972, -0.983679328, -0.982277908, -0.980785564, -0.979198011, -0.977510822, -0.975719424, -0.973819101, -0.971804986, -0.969672063, -0.967415164, -0.965028968, -0.962508, -0.959846632, -0.957039078, -0.954079401, -0.950961508, -0.947679152, -0.944225939, -0.940595321, -0.936780609, -0.932774969, -0.928571429, -0.924162885, -0.919542108, -0.914701748, -0.909634344, -0.904332331, -0.898788053, -0.892993774, -0.886941687, -0.880623932, -0.874032608, -0.867159791, -0.859997551, -0.852537972, -0.844773175, -0.836695333, -0.828296703, -0.819569649, -0.810506665, -0.801100408, -0.791343727, -0.781229695, -0.770751638, -0.759903174, -0.748678248, -0.737071165, -0.725076632, -0.712689794, -0.699906275, -0.686722216, -0.673134319, -0.659139882, -0.644736842, -0.629923817, -0.614700141, -0.599065905, -0.58302199, -0.566570106, -0.549712823, -0.532453602, -0.51479682, -0.496747799, -0.478312822, -0.459499156, -0.440315059, -0.420769791, -0.400873617, -0.380637807, -0.360074627, -0.339197326, -0.318020121, -0.296558171, -0.274827545, -0.252845192, -0.230628896, -0.208197228, -0.185569498, -0.162765694, -0.139806421, -0.116712836, -0.0935065725, -0.0702096726, -0.0468445048, -0.023433686, 0, 0.023433686, 0.0468445048, 0.0702096726, 0.0935065725, 0.116712836, 0.139806421, 0.162765694, 0.185569498, 0.208197228, 0.230628896, 0.252845192, 0.274827545, 0.296558171, 0.318020121, 0.339197326, 0.360074627, 0.380637807, 0.400873617, 0.420769791, 0.440315059, 0.459499156, 0.478312822, 0.496747799, 0.51479682, 0.532453602, 0.549712823, 0.566570106, 0.58302199, 0.599065905, 0.614700141, 0.629923817, 0.644736842, 0.659139882, 0.673134319, 0.686722216, 0.699906275, 0.712689794, 0.725076632, 0.737071165, 0.748678248, 0.759903174, 0.770751638, 0.781229695, 0.791343727, 0.801100408, 0.810506665, 0.819569649, 0.828296703, 0.836695333, 0.844773175, 0.852537972, 0.859997551, 0.867159791, 0.874032608, 0.880623932, 0.886941687, 0.892993774, 0.898788053, 0.904332331, 0.909634344, 0.914701748, 0.919542108, 0.924162885, 0.928571429, 0.932774969, 0.936780609, 0.940595321, 0.944225939, 0.947679152, 0.950961508, 0.954079401, 0.957039078, 0.959846632, 0.962508, 0.965028968, 0.967415164, 0.969672063, 0.971804986, 0.973819101, 0.975719424, 0.977510822, 0.979198011, 0.980785564, 0.982277908, 0.983679328, 0.984993972, 0.98622585, 0.987378837, 0.98845668, 0.989462995, 0.990401277, 0.991274895, 0.992087101, 0.992841031, 0.993539708, 0.994186047, 0.994782852, 0.995332828, 0.995838577, 0.996302604, 0.99672732, 0.997115041, 0.997467999, 0.997788336, 0.998078111, 0.998339306, 0.99857382, 0.998783479, 0.998970036, 0.999135174, 0.999280507, 0.999407583, 0.999517888, 0.999612846, 0.999693821, 0.999762123, 0.999819003, 0.999865663, 0.999903251, 0.999932868, 0.999955566, 0.999972352, 0.999984191, 0.999992002, 0.999996665, 0.999999024, 0.999999879, 1 };
+const float __leaf_table_adaaTanhF1[ADAA_TABLE_SIZE] = { 2.34839248, 2.32495498, 2.30151749, 2.27808004, 2.25464267, 2.23120544, 2.20776844, 2.18433177, 2.16089557, 2.13745997, 2.11402517, 2.09059134, 2.06715873, 2.04372758, 2.02029818, 1.99687084, 1.9734459, 1.95002374, 1.92660477, 1.90318943, 1.87977822, 1.85637164, 1.83297026, 1.80957469, 1.78618557, 1.7628036, 1.73942952, 1.71606411, 1.69270821, 1.66936273, 1.6460286, 1.62270685, 1.59939852, 1.57610476, 1.55282676, 1.52956577, 1.50632313, 1.48310024, 1.45989858, 1.43671969, 1.41356523, 1.3904369, 1.36733651, 1.34426595, 1.32122722, 1.29822239, 1.27525364, 1.25232326, 1.22943363, 1.20658726, 1.18378675, 1.16103483, 1.13833434, 1.11568825, 1.09309966, 1.07057179, 1.04810799, 1.02571177, 1.00338676, 0.981136735, 0.958965632, 0.93687753, 0.914876665, 0.89296743, 0.871154384, 0.849442246, 0.827835907, 0.806340425, 0.784961036, 0.763703148, 0.742572351, 0.721574412, 0.700715282, 0.680001095, 0.659438172, 0.639033016, 0.618792318, 0.598722954, 0.578831985, 0.559126657, 0.539614398, 0.520302815, 0.501199695, 0.482312997, 0.463650851, 0.445221552, 0.427033553, 0.409095462, 0.391416033, 0.374004155, 0.356868849, 0.340019253, 0.323464614, 0.307214276, 0.291277665, 0.275664281, 0.260383676, 0.245445445, 0.230859205, 0.216634583, 0.202781192, 0.189308615, 0.176226386, 0.163543967, 0.151270729, 0.13941593, 0.127988692, 0.116997976, 0.106452563, 0.0963610292, 0.0867317208, 0.077572732, 0.0688918814, 0.0606966882, 0.05299435, 0.0457917198, 0.039095285, 0.0329111455, 0.0272449944, 0.0221020988, 0.0174872813, 0.0134049043, 0.00985885413, 0.00685252773, 0.00438882036, 0.00247011532, 0.00109827536, 0.000274635854, 0, 0.000274635854, 0.00109827536, 0.00247011532, 0.00438882036, 0.00685252773, 0.00985885413, 0.0134049043, 0.0174872813, 0.0221020988, 0.0272449944, 0.0329111455, 0.039095285, 0.0457917198, 0.05299435, 0.0606966882, 0.0688918814, 0.077572732, 0.0867317208, 0.0963610292, 0.106452563, 0.116997976, 0.127988692, 0.13941593, 0.151270729, 0.163543967, 0.176226386, 0.189308615, 0.202781192, 0.216634583, 0.230859205, 0.245445445, 0.260383676, 0.275664281, 0.291277665, 0.307214276, 0.323464614, 0.340019253, 0.356868849, 0.374004155, 0.391416033, 0.409095462, 0.427033553, 0.445221552, 0.463650851, 0.482312997, 0.501199695, 0.520302815, 0.539614398, 0.559126657, 0.578831985, 0.598722954, 0.618792318, 0.639033016, 0.659438172, 0.680001095, 0.700715282, 0.721574412, 0.742572351, 0.763703148, 0.784961036, 0.806340425, 0.827835907, 0.849442246, 0.871154384, 0.89296743, 0.914876665, 0.93687753, 0.958965632, 0.981136735, 1.00338676, 1.02571177, 1.04810799, 1.07057179, 1.09309966, 1.11568825, 1.13833434, 1.16103483, 1.18378675, 1.20658726, 1.22943363, 1.25232326, 1.27525364, 1.29822239, 1.32122722, 1.34426595, 1.36733651, 1.3904369, 1.41356523, 1.43671969, 1.45989858, 1.48310024, 1.50632313, 1.52956577, 1.55282676, 1.57610476, 1.59939852, 1.62270685, 1.6460286, 1.66936273, 1.69270821, 1.71606411, 1.73942952, 1.7628036, 1.78618557, 1.80957469, 1.83297026, 1.85637164, 1.87977822, 1.90318943, 1.92660477, 1.95002374, 1.9734459, 1.99687084, 2.02029818, 2.04372758, 2.06715873, 2.09059134, 2.11402517, 2.13745997, 2.16089557, 2.18433177, 2.20776844, 2.23120544, 2.25464267, 2.27808004, 2.30151749, 2.32495498, 2.34839248 };
+const double __leaf_table_adaaTanhF2[ADAA_TABLE_SIZE] = { -2.881975749104142, -2.8272099585189707, -2.7729934842402191, -2.7193263257626867, -2.6662084817542411, -2.6136399496143881, -2.561620725012161, -2.5101508014024771, -2.4592301695201533, -2.4088588168506986, -2.3590367270769868, -2.309763879500883, -2.2610402484388556, -2.2128658025906054, -2.1652405043796605, -2.1181643092649098, -2.0716371650219729, -2.0256590109932873, -1.9802297773057749, -1.9353493840548719, -1.8910177404537425, -1.8472347439463794, -1.8040002792833336, -1.7613142175587413, -1.7191764152072837, -1.6775867129597097, -1.6365449347554852, -1.5960508866111223, -1.5561043554427063, -1.5167051078411018, -1.4778528887983007, -1.4395474203833438, -1.4017884003662182, -1.3645755007881233, -1.3279083664764535, -1.2917866135028704, -1.2562098275827656, -1.2211775624144661, -1.186689337956476, -1.1527446386410887, -1.1193429115226712, -1.0864835643589581, -1.0541659636237073, -1.0223894324490597, -0.99115324849602482, -0.96045664175151346, -0.93029879225040446, -0.90067882772118635, -0.87159582115377976, -0.8430487882882387, -0.81503668502309612, -0.78755840474226124, -0.76061277555945761, -0.73419855747936502, -0.70831443947475003, -0.68295903647906009, -0.65813088629414462, -0.63382844641296643, -0.61005009075740713, -0.58679410633152873, -0.56405868979091611, -0.54184194392905161, -0.5201418740819741, -0.49895638445285773, -0.4782832743585157, -0.45812023440024774, -0.43846484256190665, -0.41931456023851554, -0.40066672819929261, -0.38251856248946536, -0.36486715027582939, -0.34770944564161566, -0.33104226533685477, -0.31486228449109577, -0.29916603229603611, -0.28394988766633977, -0.26921007488766913, -0.25494265926174009, -0.24114354275900673, -0.22780845969039198, -0.21493297241033105, -0.20251246706422066, -0.19054214939422964, -0.17901704061827894, -0.16793197339783728, -0.15728158791100899, -0.14706032804822433, -0.1372624377485927, -0.12788195749575415, -0.11891272099274186, -0.11034835203602311, -0.10218226160944388, -0.094407645219298342, -0.087017480492150412, -0.080004525057318032, -0.073361314736111849, -0.067080162059988346, -0.061153155139663573, -0.055572156907017112, -0.05032880475121182, -0.045414510569866895, -0.040820461255402174, -0.036537619635691909, -0.032556725887071813, -0.028868299436377143, -0.025462641367176575, -0.022329837343621595, -0.019459761063401526, -0.01684207824916073, -0.014466251185428769, -0.012321543805613455, -0.010397027330957376, -0.0086815864605689352, -0.0071639261086925421, -0.0058325786823689718, -0.0046759118895171037, -0.0036821370643045359, -0.0028393179934860235, -0.0021353802242073394, -0.0015581208306236771, -0.0010952186136247155, -0.00073424470497407412, -0.00046267354436191344, -0.00026789419521061619, -0.00013722196262250241, -5.7910274650352367e-05, -1.7162786102281613e-05, -2.1456624467036667e-06, 0, 2.1456624467036667e-06, 1.7162786102281613e-05, 5.7910274650796456e-05, 0.00013722196262250241, 0.00026789419521061619, 0.00046267354436235753, 0.0007342447049749623, 0.0010952186136260478, 0.0015581208306245653, 0.0021353802242082276, 0.0028393179934869117, 0.0036821370643054241, 0.0046759118895175478, 0.0058325786823685277, 0.007163926108692098, 0.0086815864605680471, 0.010397027330956932, 0.012321543805613455, 0.014466251185429657, 0.016842078249161618, 0.01945976106340197, 0.022329837343622927, 0.025462641367177907, 0.028868299436378475, 0.032556725887074034, 0.03653761963569413, 0.04082046125540395, 0.045414510569869115, 0.050328804751214484, 0.05557215690702022, 0.061153155139667126, 0.067080162059991455, 0.073361314736114958, 0.080004525057320253, 0.087017480492152188, 0.094407645219300562, 0.10218226160944699, 0.11034835203602666, 0.11891272099274586, 0.12788195749575815, 0.13726243774859714, 0.14706032804822833, 0.15728158791101254, 0.16793197339784083, 0.1790170406182825, 0.19054214939423231, 0.20251246706422377, 0.21493297241033371, 0.22780845969039376, 0.24114354275900762, 0.25494265926174098, 0.26921007488767001, 0.28394988766634066, 0.299166032296037, 0.31486228449109666, 0.33104226533685477, 0.34770944564161521, 0.3648671502758285, 0.38251856248946359, 0.40066672819929172, 0.41931456023851377, 0.43846484256190488, 0.45812023440024596, 0.47828327435851392, 0.49895638445285595, 0.52014187408197143, 0.54184194392904894, 0.564058689790913, 0.58679410633152562, 0.61005009075740446, 0.63382844641296376, 0.65813088629414196, 0.68295903647905742, 0.70831443947474693, 0.73419855747936147, 0.76061277555945406, 0.78755840474225725, 0.81503668502309257, 0.84304878828823515, 0.87159582115377621, 0.90067882772118235, 0.93029879225040002, 0.96045664175150947, 0.99115324849602082, 1.0223894324490557, 1.0541659636237029, 1.0864835643589537, 1.1193429115226659, 1.1527446386410833, 1.1866893379564702, 1.2211775624144598, 1.2562098275827598, 1.2917866135028646, 1.3279083664764482, 1.3645755007881171, 1.4017884003662138, 1.4395474203833389, 1.4778528887982967, 1.5167051078410969, 1.5561043554427014, 1.5960508866111178, 1.6365449347554799, 1.6775867129597044, 1.7191764152072775, 1.761314217558736, 1.8040002792833292, 1.8472347439463732, 1.8910177404537354, 1.9353493840548648, 1.9802297773057678, 2.0256590109932811, 2.0716371650219658, 2.1181643092649027, 2.1652405043796543, 2.2128658025906001, 2.2610402484388503, 2.3097638795008786, 2.3590367270769814, 2.4088588168506924, 2.4592301695201471, 2.5101508014024709, 2.5616207250121548, 2.613639949614381, 2.666208481754234, 2.7193263257626805, 2.7729934842402129, 2.8272099585189645, 2.8819757491041367 };
+const float __leaf_table_adaaShaper[ADAA_TABLE_SIZE] = { 0, 0.00114452756, 0.00439660553, 0.00949522947, 0.0161940208, 0.0242607618, 0.0334769388, 0.0436372941, 0.0545493849, 0.0660331521, 0.0779204954, 0.0900548575, 0.102290816, 0.114493682, 0.12653911, 0.138312709, 0.14970967, 0.160634392, 0.171000122, 0.180728603, 0.18974972, 0.198001165, 0.205428104, 0.211982851, 0.217624547, 0.222318852, 0.22603764, 0.2287587, 0.230465447, 0.231146637, 0.230796092, 0.229412425, 0.226998782, 0.223562581, 0.219115262, 0.213672042, 0.207251678, 0.199876235, 0.191570859, 0.18236356, 0.172284994, 0.161368262, 0.149648701, 0.137163696, 0.123952483, 0.11005597, 0.0955165552, 0.080377957, 0.064685044, 0.0484836746, 0.0318205399, 0.0147430129, -0.00270099763, -0.0204631878, -0.0384949941, -0.0567477239, -0.0751726812, -0.0937212865, -0.112345193, -0.130996399, -0.149627349, -0.168191041, -0.186641122, -0.204931976, -0.223018818, -0.240857772, -0.258405955, -0.275621548, -0.292463868, -0.308893434, -0.324872033, -0.34036277, -0.355330132, -0.369740031, -0.383559857, -0.396758515, -0.409306468, -0.421175774, -0.432340112, -0.442774818, -0.452456905, -0.461365087, -0.469479799, -0.476783208, -0.483259229, -0.488893535, -0.493673559, -0.4975885, -0.500629322, -0.502788754, -0.504061281, -0.50444314, -0.503932304, -0.502528475, -0.500233065, -0.497049177, -0.492981587, -0.488036721, -0.482222629, -0.475548956, -0.468026918, -0.459669266, -0.450490256, -0.44050561, -0.429732485, -0.418189427, -0.405896339, -0.392874431, -0.379146182, -0.364735291, -0.349666635, -0.333966216, -0.317661117, -0.300779446, -0.28335029, -0.265403658, -0.246970431, -0.228082304, -0.208771733, -0.189071875, -0.169016536, -0.14864011, -0.127977519, -0.107064158, -0.0859358317, -0.0646286966, -0.0431792, -0.0216240191, 0, 0.0216559029, 0.0433066888, 0.0649153712, 0.0864450398, 0.107858921, 0.129120439, 0.150193278, 0.17104144, 0.191629307, 0.211921702, 0.231883942, 0.251481907, 0.270682087, 0.289451648, 0.307758483, 0.325571273, 0.342859535, 0.359593684, 0.375745079, 0.391286079, 0.406190093, 0.420431628, 0.433986341, 0.446831079, 0.458943932, 0.470304273, 0.480892802, 0.490691584, 0.499684093, 0.507855243, 0.515191432, 0.521680567, 0.527312102, 0.532077066, 0.535968089, 0.538979431, 0.541107, 0.54234838, 0.542702845, 0.542171375, 0.540756675, 0.538463181, 0.535297069, 0.531266265, 0.526380445, 0.520651038, 0.51409122, 0.506715913, 0.498541774, 0.489587185, 0.479872237, 0.469418713, 0.458250071, 0.446391411, 0.433869456, 0.420712517, 0.406950457, 0.392614658, 0.377737972, 0.362354681, 0.346500445, 0.33021225, 0.31352835, 0.296488205, 0.279132419, 0.261502665, 0.243641618, 0.225592873, 0.207400861, 0.18911077, 0.170768445, 0.152420301, 0.134113214, 0.115894425, 0.097811423, 0.0799118371, 0.0622433127, 0.0448533898, 0.0277893733, 0.011098199, -0.00517370546, -0.0209805651, -0.0362774071, -0.0510202158, -0.0651660932, -0.0786734242, -0.0915020485, -0.103613437, -0.114970874, -0.125539648, -0.135287239, -0.144183529, -0.152200996, -0.159314935, -0.16550367, -0.170748782, -0.175035335, -0.178352116, -0.180691875, -0.182051574, -0.182432646, -0.181841252, -0.180288551, -0.177790979, -0.174370526, -0.170055024, -0.164878449, -0.158881216, -0.152110492, -0.144620513, -0.136472904, -0.127737013, -0.118490248, -0.108818422, -0.0988161029, -0.0885869786, -0.0782442203, -0.0679108591, -0.0577201687, -0.047816055, -0.038353455, -0.0294987422, -0.0214301407, -0.0143381467, -0.00842595882, -0.00390991535, -0.0010199408, -0 };
+const float __leaf_table_adaaShaperF1[ADAA_TABLE_SIZE] = { 0.189540239, 0.189544497, 0.18957329, 0.189648448, 0.189788998, 0.190011325, 0.190329322, 0.190754543, 0.191296346, 0.19196203, 0.192756971, 0.193684754, 0.194747294, 0.19594496, 0.19727669, 0.198740104, 0.20033161, 0.202046511, 0.203879102, 0.205822767, 0.207870072, 0.210012848, 0.212242283, 0.214548998, 0.216923123, 0.219354376, 0.221832129, 0.224345475, 0.226883293, 0.229434312, 0.231987161, 0.234530428, 0.237052713, 0.239542673, 0.241989071, 0.244380814, 0.246707001, 0.248956955, 0.251120259, 0.253186791, 0.255146753, 0.2569907, 0.258709564, 0.260294681, 0.261737808, 0.263031146, 0.264167356, 0.265139577, 0.265941433, 0.266567055, 0.267011081, 0.26726867, 0.267335509, 0.267207814, 0.266882339, 0.266356373, 0.265627745, 0.264694821, 0.2635565, 0.262212219, 0.260661936, 0.258906138, 0.256945823, 0.254782499, 0.252418175, 0.249855346, 0.24709699, 0.244146552, 0.241007932, 0.237685473, 0.234183948, 0.230508544, 0.22666485, 0.222658837, 0.218496846, 0.214185569, 0.209732035, 0.205143588, 0.200427874, 0.195592818, 0.190646612, 0.185597689, 0.18045471, 0.175226541, 0.169922237, 0.16455102, 0.159122261, 0.153645459, 0.148130224, 0.142586256, 0.137023324, 0.13145125, 0.125879888, 0.120319103, 0.114778756, 0.109268682, 0.103798672, 0.0983784561, 0.0930176836, 0.0877259066, 0.0825125616, 0.0773869528, 0.072358235, 0.0674353976, 0.0626272483, 0.0579423973, 0.0533892426, 0.0489759549, 0.0447104636, 0.040600443, 0.0366532988, 0.0328761558, 0.0292758453, 0.025858894, 0.0226315122, 0.0195995839, 0.0167686567, 0.0141439323, 0.0117302581, 0.00953211889, 0.00755362965, 0.00579852838, 0.00427017018, 0.00297152161, 0.0019051559, 0.00107324863, 0.000477574295, 0.000119503338, 0, 0.000119620767, 0.000478513522, 0.00107641736, 0.00191266311, 0.00298617447, 0.0042954699, 0.00583866512, 0.00761347632, 0.00961722401, 0.0118468375, 0.0142988603, 0.0169694555, 0.0198544128, 0.0229491551, 0.0262487468, 0.0297479015, 0.0334409916, 0.0373220576, 0.0413848182, 0.0456226811, 0.0500287546, 0.054595859, 0.0593165392, 0.064183078, 0.0691875088, 0.0743216304, 0.0795770206, 0.0849450517, 0.0904169056, 0.0959835894, 0.101635952, 0.1073647, 0.113160414, 0.119013569, 0.124914548, 0.130853663, 0.136821169, 0.142807287, 0.148802221, 0.154796176, 0.160779376, 0.166742087, 0.17267463, 0.178567408, 0.184410918, 0.190195775, 0.195912731, 0.20155269, 0.207106734, 0.212566137, 0.217922384, 0.223167195, 0.228292536, 0.233290645, 0.238154043, 0.242875557, 0.247448335, 0.251865864, 0.256121984, 0.260210907, 0.264127232, 0.267865959, 0.271422503, 0.27479271, 0.277972866, 0.280959714, 0.283750461, 0.286342793, 0.288734879, 0.290925386, 0.292913484, 0.29469885, 0.296281679, 0.297662686, 0.298843109, 0.299824709, 0.300609778, 0.301201131, 0.301602108, 0.301816569, 0.30184889, 0.301703958, 0.301387159, 0.300904373, 0.30026196, 0.299466744, 0.298526006, 0.297447457, 0.296239228, 0.294909841, 0.293468192, 0.291923522, 0.290285393, 0.288563652, 0.286768404, 0.284909978, 0.282998885, 0.281045779, 0.279061421, 0.277056625, 0.275042216, 0.273028977, 0.271027595, 0.269048606, 0.267102332, 0.265198822, 0.263347784, 0.261558512, 0.259839821, 0.258199963, 0.256646552, 0.255186477, 0.253825818, 0.252569754, 0.251422467, 0.250387043, 0.249465372, 0.24865804, 0.247964216, 0.247381538, 0.246905996, 0.246531801, 0.246251266, 0.246054663, 0.245930091, 0.245863333, 0.245837707, 0.24583391 };
+const double __leaf_table_adaaShaperF2[ADAA_TABLE_SIZE] = { -0.24290769197536421, -0.24081353657350882, -0.23871922002738474, -0.23662434800965121, -0.23452830063574731, -0.23243026254413154, -0.23032925124781808, -0.22822414381296052, -0.22611370191922786, -0.22399659535572017, -0.2218714240051797, -0.21973673836827237, -0.21759105867873813, -0.21543289265924537, -0.2132607519668249, -0.21107316737580811, -0.20886870274525507, -0.20664596781692107, -0.20440362988888644, -0.202140424409057, -0.19985516453183103, -0.19754674968032923, -0.19521417315568934, -0.1928565288340422, -0.19047301699090885, -0.18806294929188896, -0.18562575298764905, -0.18316097435036752, -0.18066828138794649, -0.17814746587146552, -0.17559844471052138, -0.17302126071027935, -0.17041608274324715, -0.16778320536797914, -0.16512304792612084, -0.16243615314841658, -0.15972318529952134, -0.15698492789068696, -0.15422228098862684, -0.15143625814810951, -0.14862798299508062, -0.1457986854863749, -0.14294969787134754, -0.14008245038002831, -0.13719846666169, -0.13429935899701076, -0.13138682330631307, -0.12846263397566987, -0.12552863852198401, -0.12258675211747282, -0.11963895199332181, -0.11668727174161202, -0.11373379553397479, -0.11078065227478455, -0.10783000970606414, -0.10488406848065232, -0.10194505621956204, -0.099015221568848288, -0.096096828270701928, -0.093192149262889948, -0.090303460820077452, -0.08743303674998737, -0.084583142656782906, -0.081756030283497205, -0.078953931944777886, -0.076179055060670062, -0.07343357680162213, -0.070719638854369007, -0.068039342317824894, -0.065394742737604511, -0.06278784528728569, -0.060220600104027494, -0.057694897785669996, -0.05521256505595884, -0.052775360604064347, -0.050384971104100562, -0.048043007419890468, -0.045751000999775859, -0.043510400465828103, -0.041322568401383167, -0.039188778340399383, -0.037110211961719028, -0.035087956490905958, -0.033123002311930938, -0.031216240790582883, -0.029368462311100102, -0.027580354527138889, -0.025852500827827654, -0.024185379019295031, -0.022579360221707395, -0.021034707981507417, -0.019551577598208206, -0.018130015664770391, -0.016769959820268118, -0.015471238713239556, -0.01423357217381141, -0.01305657159239286, -0.011939740502445978, -0.010882475364558795, -0.0098840665487776244, -0.008943699511889544, -0.0080604561660915577, -0.0072333164352358023, -0.0064611599945990569, -0.0057427681898961011, -0.0050768261310305124, -0.0044619249558631724, -0.0038965642590715679, -0.0033791546809722461, -0.0029080206509905504, -0.0024814032802762398, -0.0020974633977904958, -0.0017542847240230308, -0.0014498771763378146, -0.001182180299797865, -0.00094906681717459376, -0.00074834629171431633, -0.00057776889610816964, -0.00043502928099196231, -0.00031777053619461149, -0.0002235882378493273, -0.0001500345743892656, -9.4622544363192479e-05, -5.4830218927579694e-05, -2.8105061803885417e-05, -1.1868299425728951e-05, -3.5193339485619507e-06, -4.4019174874404196e-07, 0, 4.4051611192618897e-07, 3.5245229992510868e-06, 1.1894562581483276e-05, 2.8188037973955749e-05, 5.5032708434160291e-05, 9.5042201031025203e-05, 0.00015081154648583645, 0.00022491274660482383, 0.00031989038068821682, 0.00043825725825893252, 0.00058249012540049008, 0.00075502543193639582, 0.00095825516661472709, 0.001194522767385759, 0.0014661191137785821, 0.0017752786082885219, 0.0021241753535898369, 0.0025149194322787727, 0.0029495532957363041, 0.0034300482685771586, 0.0039583011750176089, 0.004536131093356488, 0.0051652762446144571, 0.0058473910212198596, 0.0065840431614672679, 0.0073767110752992957, 0.0082267813267848308, 0.0091355462784763058, 0.010104201902631983, 0.011133845764086422, 0.012225475179336531, 0.013379985556192742, 0.014598168918113691, 0.015880712617106454, 0.0172281982388304, 0.018641100703287158, 0.02011978756422049, 0.021664518510079042, 0.023275445069117412, 0.024952610520926899, 0.026695950016391995, 0.028505290907768474, 0.030380353290268641, 0.032320750756220859, 0.034325991362546715, 0.036395478811962242, 0.038528513847970625, 0.040724295863361848, 0.042981924721576706, 0.045300402789927849, 0.047678637183294126, 0.050115442216523962, 0.052609542063392037, 0.055159573619555119, 0.057764089566546703, 0.060421561633435109, 0.063130384052347485, 0.065888877203629598, 0.068695291445975498, 0.071547811126411176, 0.074444558764562782, 0.07738359940517707, 0.080362945132388897, 0.083380559738753968, 0.086434363541575285, 0.08952223833855727, 0.092642032494318807, 0.095791566148782703, 0.098968636537942592, 0.1021710234169774, 0.10539649457514995, 0.10864281143138167, 0.11190773469884217, 0.11518903010633559, 0.11848447416369405, 0.1217918599578143, 0.12510900296538996, 0.12843374686779652, 0.13176396935299006, 0.13509758788866863, 0.13843256545033039, 0.14176691618723813, 0.14509871100866575, 0.14842608307216312, 0.15174723315492628, 0.15506043488870219, 0.15836403983799421, 0.16165648240065869, 0.16493628450930475, 0.16820206011121874, 0.1714525194038366, 0.17468647280208469, 0.17790283461319259, 0.18110062639386412, 0.18427897996395909, 0.18743714005010373, 0.19057446653190044, 0.19369043626265359, 0.19678464443576762, 0.1998568054672025, 0.20290675336359304, 0.20593444154485521, 0.20893994208930405, 0.21192344436851024, 0.21488525303830844, 0.21782578535155395, 0.22074556775739737, 0.22364523175101178, 0.22652550893686546, 0.22938722526778166, 0.23223129442116805, 0.23505871027293249, 0.23787053842872535, 0.24066790677126765, 0.24345199498163128, 0.24622402299143939, 0.24898523832204797, 0.2517369022658531, 0.25448027486394714, 0.25721659863341328, 0.25994708099661024, 0.2626728753638502, 0.26539506081991715, 0.26811462036391104, 0.27083241765092891, 0.2735491721831147, 0.27626543289662409, 0.27898155009004988 };
+#endif // LEAF_INCLUDE_ADAA_TABLES
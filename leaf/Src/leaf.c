@@ -18,6 +18,11 @@
 
 #endif
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define LEAF_DENORMAL_MXCSR 1
+#endif
+
 void LEAF_init(LEAF* const leaf, float sr, char* memory, size_t memorysize, float(*random)(void))
 {
     leaf->_internal_mempool.leaf = leaf;
@@ -31,6 +36,10 @@ void LEAF_init(LEAF* const leaf, float sr, char* memory, size_t memorysize, floa
 
     leaf->random = random;
     
+    leaf->controlRate = 1;
+    
+    leaf->quality = (LEAFQuality) LEAF_DEFAULT_QUALITY;
+    
     leaf->clearOnAllocation = 0;
     
     leaf->errorCallback = &LEAF_defaultErrorCallback;
@@ -55,6 +64,23 @@ float LEAF_getSampleRate(LEAF* const leaf)
     return leaf->sampleRate;
 }
 
+void LEAF_setControlRate(LEAF* const leaf, int controlRate)
+{
+    if (controlRate < 1) controlRate = 1;
+    leaf->controlRate = controlRate;
+}
+
+void LEAF_setQuality(LEAF* const leaf, LEAFQuality quality)
+{
+    if (quality < LEAFQualityHigh || quality >= LEAFQualityNil) quality = LEAFQualityHigh;
+    leaf->quality = quality;
+}
+
+LEAFQuality LEAF_getQuality(LEAF* const leaf)
+{
+    return LEAF_QUALITY(leaf);
+}
+
 void LEAF_defaultErrorCallback(LEAF* const leaf, LEAFErrorType whichone)
 {
     // Not sure what this should do if anything
@@ -71,3 +97,46 @@ void LEAF_setErrorCallback(LEAF* const leaf, void (*callback)(LEAF* const, LEAFE
 {
     leaf->errorCallback = callback;
 }
+
+int LEAF_DenormalGuard_begin(LEAF_DenormalGuard* const guard)
+{
+#if defined(LEAF_DENORMAL_MXCSR)
+    // flush-to-zero (bit 15) for results and denormals-are-zero (bit 6) for inputs
+    unsigned int csr = _mm_getcsr();
+    guard->state = csr;
+    _mm_setcsr(csr | 0x8040);
+    guard->active = 1;
+#elif defined(__aarch64__)
+    // FZ (bit 24) covers both inputs and results
+    unsigned long long fpcr;
+    __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+    guard->state = fpcr;
+    __asm__ __volatile__ ("msr fpcr, %0" : : "r" (fpcr | (1ULL << 24)));
+    guard->active = 1;
+#elif defined(__arm__) && defined(__ARM_FP)
+    unsigned int fpscr;
+    __asm__ __volatile__ ("vmrs %0, fpscr" : "=r" (fpscr));
+    guard->state = fpscr;
+    __asm__ __volatile__ ("vmsr fpscr, %0" : : "r" (fpscr | (1U << 24)));
+    guard->active = 1;
+#else
+    guard->state = 0;
+    guard->active = 0;
+#endif
+    return guard->active;
+}
+
+void LEAF_DenormalGuard_end(LEAF_DenormalGuard* const guard)
+{
+    if (!guard->active) return;
+#if defined(LEAF_DENORMAL_MXCSR)
+    _mm_setcsr((unsigned int) guard->state);
+#elif defined(__aarch64__)
+    unsigned long long fpcr = guard->state;
+    __asm__ __volatile__ ("msr fpcr, %0" : : "r" (fpcr));
+#elif defined(__arm__) && defined(__ARM_FP)
+    unsigned int fpscr = (unsigned int) guard->state;
+    __asm__ __volatile__ ("vmsr fpscr, %0" : : "r" (fpscr));
+#endif
+    guard->active = 0;
+}
@@ -54,10 +54,40 @@
 //! Include tables for minblep insertion, required for all tMB objects.
 #define LEAF_INCLUDE_MINBLEP_TABLES 1
 
+//! Include antiderivative tables required to use tADAAShaper.
+#define LEAF_INCLUDE_ADAA_TABLES 1
+
+//! Compile out the per-sample denormal checks in LEAF objects. Set to 1 when all LEAF processing runs between LEAF_DenormalGuard_begin() and LEAF_DenormalGuard_end(), or with flush-to-zero set some other way. The older NO_DENORMAL_CHECK define also sets it.
+#ifndef LEAF_NO_DENORMAL_CHECK
+#ifdef NO_DENORMAL_CHECK
+#define LEAF_NO_DENORMAL_CHECK 1
+#else
 #define LEAF_NO_DENORMAL_CHECK 0
+#endif
+#endif
 
 #define LEAF_USE_CMSIS 0
 
+//! Use SSE2, AVX2 or NEON intrinsics in the LEAF_*_block() math functions when the compiler targets them. With 0 they are plain loops.
+#ifndef LEAF_USE_SIMD
+#define LEAF_USE_SIMD 1
+#endif
+
+//! Also allow the NEON path under LEAF_USE_SIMD. It has not been built or checked against the scalar functions on ARM yet, so it is off by default and NEON targets use the plain loops.
+#ifndef LEAF_USE_NEON
+#define LEAF_USE_NEON 0
+#endif
+
+//! Approximation tier that new LEAF instances start with: 0 for libm (LEAFQualityHigh), 1 for LEAFQualityBalanced, 2 for LEAFQualityFast. Change it per instance with LEAF_setQuality().
+#ifndef LEAF_DEFAULT_QUALITY
+#define LEAF_DEFAULT_QUALITY 0
+#endif
+
+//! Set to 0, 1 or 2 to fix the approximation tier at compile time, so the tier checks fold away and LEAF_setQuality() has no effect. -1 keeps it a runtime setting.
+#ifndef LEAF_FIXED_QUALITY
+#define LEAF_FIXED_QUALITY -1
+#endif
+
 #ifdef __cplusplus
 //! Use stdlib malloc() and free() internally instead of LEAF's normal mempool behavior for when you want to avoid being limited to and managing mempool a fixed mempool size. Usage of all object remains essentially the same.
 
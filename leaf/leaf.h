@@ -161,6 +161,24 @@ extern "C" {
      */
     float       LEAF_getSampleRate   (LEAF* const leaf);
     
+    //! Set the default control rate of LEAF.
+    /*!
+     @param controlRate The number of samples between updates of envelopes and LFOs rendered with their tickBlock functions. Objects with their own control rate set ignore this. Defaults to 1 (audio rate).
+     */
+    void        LEAF_setControlRate  (LEAF* const leaf, int controlRate);
+    
+    //! Set the approximation tier of LEAF.
+    /*!
+     @param quality LEAFQualityHigh uses libm, LEAFQualityBalanced and LEAFQualityFast trade accuracy for speed in tSVF, tVZFilter, tDiodeFilter and tNeuron. Takes effect on the next coefficient update of objects allocated from this instance. Defaults to LEAF_DEFAULT_QUALITY and is ignored when LEAF_FIXED_QUALITY is set.
+     */
+    void        LEAF_setQuality      (LEAF* const leaf, LEAFQuality quality);
+    
+    //! Get the approximation tier of LEAF.
+    /*!
+     @return The current LEAFQuality.
+     */
+    LEAFQuality LEAF_getQuality      (LEAF* const leaf);
+    
     //! The default callback function for LEAF errors.
     /*!
      @param errorType The type of the error that has occurred.
@@ -175,6 +193,20 @@ extern "C" {
      */
     void LEAF_setErrorCallback(LEAF* const leaf, void (*callback)(LEAF* const, LEAFErrorType));
     
+    //! Flush denormals to zero on this thread until LEAF_DenormalGuard_end(), for the duration of a processing block.
+    /*!
+     Sets FTZ and DAZ in MXCSR on x86, FZ in FPCR on ARM64 and FZ in FPSCR on ARM with a VFP unit. Recursive objects (filters, reverb and string tails) then decay to zero at full speed instead of slowing down on denormal math. Build with LEAF_NO_DENORMAL_CHECK set to 1 to drop the per-sample denormal checks when every block is guarded.
+     @param guard The state to restore when the guard ends.
+     @return 1 if flush-to-zero was set, 0 on platforms without control over it.
+     */
+    int         LEAF_DenormalGuard_begin (LEAF_DenormalGuard* const guard);
+    
+    //! Restore the floating-point control state from before LEAF_DenormalGuard_begin().
+    /*!
+     @param guard The guard passed to LEAF_DenormalGuard_begin().
+     */
+    void        LEAF_DenormalGuard_end   (LEAF_DenormalGuard* const guard);
+    
     /*! @} */
     
 #ifdef __cplusplus